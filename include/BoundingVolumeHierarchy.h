@@ -0,0 +1,104 @@
+// File:    BoundingVolumeHierarchy.h
+// Author:  Danilo Peixoto
+// Date:    17/10/2026
+
+// Evita redefinição de símbolos do arquivo de cabeçalho (caso já tenha sido incluído)
+#ifndef CGC_BOUNDING_VOLUME_HIERARCHY_H
+#define CGC_BOUNDING_VOLUME_HIERARCHY_H
+
+#include <Vector.h>
+
+#include <vector>
+#include <ostream>
+#include <cstdint>
+
+// Declaração de tipo incompleto no cabeçalho evita dependência cíclica de arquivos
+class TriangleMesh;
+class TriangleMeshf;
+
+// Nó da hierarquia em lista contígua (32 bytes; filho à esquerda imediatamente após o pai)
+class BoundingVolumeNode {
+public:
+    Vector3f minimum; // Canto mínimo da caixa envolvente
+    Vector3f maximum; // Canto máximo da caixa envolvente
+    uint32_t offset; // Primeiro triângulo da folha ou índice do filho à direita (nó interno)
+    uint16_t count; // Número de triângulos da folha (zero para nó interno)
+    uint16_t axis; // Eixo de divisão do nó interno (ordem de visita dos filhos)
+
+    // Construtor padrão (nó interno nulo)
+    BoundingVolumeNode();
+    // Destrutor padrão
+    ~BoundingVolumeNode();
+
+    // Verifica se nó é folha
+    bool isLeaf() const;
+    // Retorna área da superfície da caixa envolvente
+    float getSurfaceArea() const;
+};
+
+// Relatório de qualidade da hierarquia
+class BoundingVolumeStatistics {
+public:
+    double cost; // Custo SAH normalizado pela área da raiz (travessia e interseção com custo unitário)
+    size_t nodeCount; // Número de nós
+    size_t leafCount; // Número de folhas
+    size_t maximumDepth; // Profundidade máxima (raiz com profundidade zero)
+    double averageLeafDepth; // Profundidade média das folhas
+    double averageLeafSize; // Número médio de triângulos por folha
+    std::vector<size_t> leafSizeHistogram; // Número de folhas por quantidade de triângulos
+
+    // Construtor padrão (relatório vazio)
+    BoundingVolumeStatistics();
+    // Destrutor padrão
+    ~BoundingVolumeStatistics();
+
+    // Sobrecarga da operação "saída << relatório" (imprimir informações na saída de dados)
+    friend std::ostream & operator <<(std::ostream & lhs, const BoundingVolumeStatistics & rhs);
+};
+
+// Hierarquia de volumes envolventes sobre triângulos (SAH por intervalos, níveis superiores em paralelo)
+class BoundingVolumeHierarchy {
+private:
+    std::vector<BoundingVolumeNode> nodes; // Lista de nós em pré-ordem
+    std::vector<uint32_t> triangles; // Índices dos triângulos na ordem das folhas
+
+public:
+    // Construtor padrão (hierarquia vazia)
+    BoundingVolumeHierarchy();
+    // Construtor para geometria de precisão dupla (caixas arredondadas para fora em precisão simples)
+    BoundingVolumeHierarchy(const TriangleMesh & triangleMesh, size_t maximumLeafSize = 4,
+        size_t threadCount = 0);
+    // Construtor para geometria de precisão simples
+    BoundingVolumeHierarchy(const TriangleMeshf & triangleMesh, size_t maximumLeafSize = 4,
+        size_t threadCount = 0);
+    // Destrutor padrão
+    ~BoundingVolumeHierarchy();
+
+    // Retorna lista de nós
+    const std::vector<BoundingVolumeNode> & getNodes() const;
+    // Retorna lista de índices de triângulos na ordem das folhas
+    const std::vector<uint32_t> & getTriangles() const;
+    // Retorna nó pelo índice (raiz é o nó zero)
+    const BoundingVolumeNode & getNode(size_t i) const;
+    // Retorna índice do triângulo na posição "i" da ordem das folhas
+    size_t getTriangle(size_t i) const;
+    // Retorna número de nós
+    size_t getNodeCount() const;
+    // Retorna tamanho da memória ocupada em bytes
+    size_t getMemorySize() const;
+    // Retorna relatório de qualidade da hierarquia
+    BoundingVolumeStatistics getStatistics() const;
+    // Verifica se hierarquia está vazia
+    bool isEmpty() const;
+
+    // Cria hierarquia para geometria de precisão dupla (até "maximumLeafSize" triângulos por folha)
+    BoundingVolumeHierarchy & create(const TriangleMesh & triangleMesh, size_t maximumLeafSize = 4,
+        size_t threadCount = 0);
+    // Cria hierarquia para geometria de precisão simples (até "maximumLeafSize" triângulos por folha)
+    BoundingVolumeHierarchy & create(const TriangleMeshf & triangleMesh, size_t maximumLeafSize = 4,
+        size_t threadCount = 0);
+    // Remove todos nós
+    BoundingVolumeHierarchy & clear();
+};
+
+#endif
@@ -0,0 +1,92 @@
+// File:    Bounds.h
+// Author:  Danilo Peixoto
+// Date:    17/10/2026
+
+// Evita redefinição de símbolos do arquivo de cabeçalho (caso já tenha sido incluído)
+#ifndef CGC_BOUNDS_H
+#define CGC_BOUNDS_H
+
+#include <Vector.h>
+
+#include <vector>
+#include <ostream>
+
+// Declaração de tipo incompleto no cabeçalho evita dependência cíclica de arquivos
+class Matrix4;
+
+// Caixa envolvente alinhada aos eixos
+class BoundingBox {
+public:
+    Vector3 minimum; // Canto mínimo
+    Vector3 maximum; // Canto máximo
+
+    // Construtor padrão (caixa vazia com mínimo maior que máximo)
+    BoundingBox();
+    // Construtor para cantos iniciais
+    BoundingBox(const Vector3 & minimum, const Vector3 & maximum);
+    // Destrutor padrão
+    ~BoundingBox();
+
+    // Sobrecarga da operação "caixaA == caixaB"
+    bool operator ==(const BoundingBox & rhs) const;
+    // Sobrecarga da operação "caixaA != caixaB"
+    bool operator !=(const BoundingBox & rhs) const;
+    // Sobrecarga da operação "saída << caixa" (imprimir saída de dados)
+    friend std::ostream & operator <<(std::ostream & lhs, const BoundingBox & rhs);
+
+    // Retorna centro da caixa
+    Vector3 getCenter() const;
+    // Retorna dimensões da caixa
+    Vector3 getSize() const;
+    // Verifica se caixa está vazia
+    bool isEmpty() const;
+    // Verifica se ponto está dentro da caixa (bordas incluídas)
+    bool contains(const Vector3 & point) const;
+
+    // Amplia caixa para conter ponto
+    BoundingBox & expand(const Vector3 & point);
+    // Amplia caixa para conter outra caixa
+    BoundingBox & expand(const BoundingBox & boundingBox);
+    // Transforma caixa utilizando matriz afim 4x4 (resultado envolve a caixa transformada e pode ser
+    // maior que a caixa dos pontos transformados)
+    BoundingBox & transform(const Matrix4 & transformation);
+};
+
+// Esfera envolvente
+class BoundingSphere {
+public:
+    Vector3 center; // Centro
+    double radius; // Raio (negativo para esfera vazia)
+
+    // Construtor padrão (esfera vazia)
+    BoundingSphere();
+    // Construtor para centro e raio iniciais
+    BoundingSphere(const Vector3 & center, double radius);
+    // Destrutor padrão
+    ~BoundingSphere();
+
+    // Sobrecarga da operação "esferaA == esferaB"
+    bool operator ==(const BoundingSphere & rhs) const;
+    // Sobrecarga da operação "esferaA != esferaB"
+    bool operator !=(const BoundingSphere & rhs) const;
+    // Sobrecarga da operação "saída << esfera" (imprimir saída de dados)
+    friend std::ostream & operator <<(std::ostream & lhs, const BoundingSphere & rhs);
+
+    // Verifica se esfera está vazia
+    bool isEmpty() const;
+    // Verifica se ponto está dentro da esfera (borda incluída)
+    bool contains(const Vector3 & point) const;
+
+    // Transforma esfera utilizando matriz afim 4x4 (raio multiplicado por limite superior da maior escala)
+    BoundingSphere & transform(const Matrix4 & transformation);
+};
+
+// Calcula caixa envolvente dos pontos e esfera envolvente centrada na caixa por redução paralela
+// vetorizada (duas passagens sequenciais sobre a lista)
+void computeBounds(const std::vector<Vector3> & points, BoundingBox & boundingBox,
+    BoundingSphere & boundingSphere, size_t threadCount = 0);
+// Calcula volumes envolventes de pontos de precisão simples (raio calculado em precisão dupla)
+void computeBounds(const std::vector<Vector3f> & points, BoundingBox & boundingBox,
+    BoundingSphere & boundingSphere, size_t threadCount = 0);
+
+#endif
@@ -1,123 +1,314 @@
-// File:    Color.h
-// Author:  Danilo Peixoto
-// Date:    05/08/2018
-
-// Evita redefinio de smbolos do arquivo de cabealho (caso j tenha sido includo)
-#ifndef CGC_COLOR_H
-#define CGC_COLOR_H
-
-#include <ostream>
-
-// Cor RGB linear
-class Color3 {
-public:
-    // Componentes de cor
-    double r, g, b;
-
-    // Construtor padro (cor preta)
-    Color3();
-    // Construtor cpia
-    Color3(const Color3 & color3);
-    // Construtor para valores iniciais
-    Color3(double r, double g, double b);
-    // Destrutor padro
-    ~Color3();
-
-    // Sobrecarga da operao "cor[i]" (retorno mutvel)
-    double & operator [](size_t i);
-    // Sobrecarga da operao "cor[i]" (retorno imutvel)
-    const double & operator [](size_t i) const;
-    // Sobrecarga da operao "+cor"
-    Color3 operator +() const;
-    // Sobrecarga da operao "-cor"
-    Color3 operator -() const;
-    // Sobrecarga da operao "corA + corB"
-    Color3 operator +(const Color3 & rhs) const;
-    // Sobrecarga da operao "corA - corB"
-    Color3 operator -(const Color3 & rhs) const;
-    // Sobrecarga da operao "cor * escalar"
-    Color3 operator *(double rhs) const;
-    // Sobrecarga da operao "escalar * cor"
-    friend Color3 operator *(double lhs, const Color3 & rhs);
-    // Sobrecarga da operao "cor / escalar"
-    Color3 operator /(double rhs) const;
-    // Sobrecarga da operao "corA += corB"
-    Color3 & operator +=(const Color3 & rhs);
-    // Sobrecarga da operao "corA -= corB"
-    Color3 & operator -=(const Color3 & rhs);
-    // Sobrecarga da operao "cor *= escalar"
-    Color3 & operator *=(double rhs);
-    // Sobrecarga da operao "cor /= escalar"
-    Color3 & operator /=(double rhs);
-    // Sobrecarga da operao "corA == corB"
-    bool operator ==(const Color3 & rhs) const;
-    // Sobrecarga da operao "corA != corB"
-    bool operator !=(const Color3 & rhs) const;
-    // Sobrecarga da operao "sada << cor" (imprimir sada de dados)
-    friend std::ostream & operator <<(std::ostream & lhs, const Color3 & rhs);
-
-    // Aplica correo gamma  cor
-    Color3 & applyGamma(double gamma);
-    // Aplica correo de exposio  cor
-    Color3 & applyExposure(double exposure);
-    // Satura cor (linear)
-    Color3 & saturate();
-};
-
-// Cor RGBA linear
-class Color4 {
-public:
-    // Componentes de cor
-    double r, g, b, a;
-
-    // Construtor padro (transparente)
-    Color4();
-    // Construtor cpia
-    Color4(const Color4 & color4);
-    // Construtor para valores iniciais
-    Color4(double r, double g, double b, double a);
-    // Destrutor padro
-    ~Color4();
-
-    // Sobrecarga da operao "cor[i]" (retorno mutvel)
-    double & operator [](size_t i);
-    // Sobrecarga da operao "cor[i]" (retorno imutvel)
-    const double & operator [](size_t i) const;
-    // Sobrecarga da operao "+cor"
-    Color4 operator +() const;
-    // Sobrecarga da operao "-cor"
-    Color4 operator -() const;
-    // Sobrecarga da operao "corA + corB"
-    Color4 operator +(const Color4 & rhs) const;
-    // Sobrecarga da operao "corA - corB"
-    Color4 operator -(const Color4 & rhs) const;
-    // Sobrecarga da operao "cor * escalar"
-    Color4 operator *(double rhs) const;
-    // Sobrecarga da operao "escalar * cor"
-    friend Color4 operator *(double lhs, const Color4 & rhs);
-    // Sobrecarga da operao "cor / escalar"
-    Color4 operator /(double rhs) const;
-    // Sobrecarga da operao "corA += corB"
-    Color4 & operator +=(const Color4 & rhs);
-    // Sobrecarga da operao "corA -= corB"
-    Color4 & operator -=(const Color4 & rhs);
-    // Sobrecarga da operao "cor *= escalar"
-    Color4 & operator *=(double rhs);
-    // Sobrecarga da operao "cor /= escalar"
-    Color4 & operator /=(double rhs);
-    // Sobrecarga da operao "corA == corB"
-    bool operator ==(const Color4 & rhs) const;
-    // Sobrecarga da operao "corA != corB"
-    bool operator !=(const Color4 & rhs) const;
-    // Sobrecarga da operao "sada << cor" (imprimir sada de dados)
-    friend std::ostream & operator <<(std::ostream & lhs, const Color4 & rhs);
-
-    // Aplica correo gamma  cor
-    Color4 & applyGamma(double gamma);
-    // Aplica correo de exposio  cor
-    Color4 & applyExposure(double exposure);
-    // Satura cor (linear)
-    Color4 & saturate();
-};
-
-#endif
\ No newline at end of file
+// File:    Color.h
+// Author:  Danilo Peixoto
+// Date:    05/08/2018
+
+// Evita redefinição de símbolos do arquivo de cabeçalho (caso já tenha sido incluído)
+#ifndef CGC_COLOR_H
+#define CGC_COLOR_H
+
+#include <Global.h>
+
+#include <ostream>
+#include <cmath>
+
+// Cor RGB linear
+class Color3 {
+public:
+    // Componentes de cor
+    double r, g, b;
+
+    // Construtor padrão (cor preta)
+    constexpr Color3();
+    // Construtor cópia (cópia trivial)
+    Color3(const Color3 & color3) = default;
+    // Construtor para valores iniciais
+    constexpr Color3(double r, double g, double b);
+    // Destrutor padrão (trivial)
+    ~Color3() = default;
+
+    // Sobrecarga da operação "cor[i]" (retorno mutável)
+    double & operator [](size_t i);
+    // Sobrecarga da operação "cor[i]" (retorno imutável)
+    const double & operator [](size_t i) const;
+    // Sobrecarga da operação "+cor"
+    constexpr Color3 operator +() const;
+    // Sobrecarga da operação "-cor"
+    constexpr Color3 operator -() const;
+    // Sobrecarga da operação "corA + corB"
+    constexpr Color3 operator +(const Color3 & rhs) const;
+    // Sobrecarga da operação "corA - corB"
+    constexpr Color3 operator -(const Color3 & rhs) const;
+    // Sobrecarga da operação "cor * escalar"
+    constexpr Color3 operator *(double rhs) const;
+    // Sobrecarga da operação "escalar * cor"
+    friend constexpr Color3 operator *(double lhs, const Color3 & rhs);
+    // Sobrecarga da operação "cor / escalar"
+    constexpr Color3 operator /(double rhs) const;
+    // Sobrecarga da operação "corA += corB"
+    Color3 & operator +=(const Color3 & rhs);
+    // Sobrecarga da operação "corA -= corB"
+    Color3 & operator -=(const Color3 & rhs);
+    // Sobrecarga da operação "cor *= escalar"
+    Color3 & operator *=(double rhs);
+    // Sobrecarga da operação "cor /= escalar"
+    Color3 & operator /=(double rhs);
+    // Sobrecarga da operação "corA == corB"
+    constexpr bool operator ==(const Color3 & rhs) const;
+    // Sobrecarga da operação "corA != corB"
+    constexpr bool operator !=(const Color3 & rhs) const;
+    // Sobrecarga da operação "saída << cor" (imprimir saída de dados)
+    friend std::ostream & operator <<(std::ostream & lhs, const Color3 & rhs);
+
+    // Aplica correção gamma à cor
+    Color3 & applyGamma(double gamma);
+    // Aplica correção de exposição à cor
+    Color3 & applyExposure(double exposure);
+    // Satura cor (linear)
+    Color3 & saturate();
+};
+
+// Cor RGBA linear
+class Color4 {
+public:
+    // Componentes de cor
+    double r, g, b, a;
+
+    // Construtor padrão (transparente)
+    constexpr Color4();
+    // Construtor cópia (cópia trivial)
+    Color4(const Color4 & color4) = default;
+    // Construtor para valores iniciais
+    constexpr Color4(double r, double g, double b, double a);
+    // Destrutor padrão (trivial)
+    ~Color4() = default;
+
+    // Sobrecarga da operação "cor[i]" (retorno mutável)
+    double & operator [](size_t i);
+    // Sobrecarga da operação "cor[i]" (retorno imutável)
+    const double & operator [](size_t i) const;
+    // Sobrecarga da operação "+cor"
+    constexpr Color4 operator +() const;
+    // Sobrecarga da operação "-cor"
+    constexpr Color4 operator -() const;
+    // Sobrecarga da operação "corA + corB"
+    constexpr Color4 operator +(const Color4 & rhs) const;
+    // Sobrecarga da operação "corA - corB"
+    constexpr Color4 operator -(const Color4 & rhs) const;
+    // Sobrecarga da operação "cor * escalar"
+    constexpr Color4 operator *(double rhs) const;
+    // Sobrecarga da operação "escalar * cor"
+    friend constexpr Color4 operator *(double lhs, const Color4 & rhs);
+    // Sobrecarga da operação "cor / escalar"
+    constexpr Color4 operator /(double rhs) const;
+    // Sobrecarga da operação "corA += corB"
+    Color4 & operator +=(const Color4 & rhs);
+    // Sobrecarga da operação "corA -= corB"
+    Color4 & operator -=(const Color4 & rhs);
+    // Sobrecarga da operação "cor *= escalar"
+    Color4 & operator *=(double rhs);
+    // Sobrecarga da operação "cor /= escalar"
+    Color4 & operator /=(double rhs);
+    // Sobrecarga da operação "corA == corB"
+    constexpr bool operator ==(const Color4 & rhs) const;
+    // Sobrecarga da operação "corA != corB"
+    constexpr bool operator !=(const Color4 & rhs) const;
+    // Sobrecarga da operação "saída << cor" (imprimir saída de dados)
+    friend std::ostream & operator <<(std::ostream & lhs, const Color4 & rhs);
+
+    // Aplica correção gamma à cor
+    Color4 & applyGamma(double gamma);
+    // Aplica correção de exposição à cor
+    Color4 & applyExposure(double exposure);
+    // Satura cor (linear)
+    Color4 & saturate();
+};
+
+constexpr Color3::Color3() : r(0), g(0), b(0) {}
+constexpr Color3::Color3(double r, double g, double b) : r(r), g(g), b(b) {}
+
+inline double & Color3::operator [](size_t i) {
+    return (&r)[i];
+}
+inline const double & Color3::operator [](size_t i) const {
+    return (&r)[i];
+}
+constexpr Color3 Color3::operator +() const {
+    return *this;
+}
+constexpr Color3 Color3::operator -() const {
+    return Color3(-r, -g, -b);
+}
+constexpr Color3 Color3::operator +(const Color3 & rhs) const {
+    return Color3(r + rhs.r, g + rhs.g, b + rhs.b);
+}
+constexpr Color3 Color3::operator -(const Color3 & rhs) const {
+    return Color3(r - rhs.r, g - rhs.g, b - rhs.b);
+}
+constexpr Color3 Color3::operator *(double rhs) const {
+    return Color3(r * rhs, g * rhs, b * rhs);
+}
+constexpr Color3 operator *(double lhs, const Color3 & rhs) {
+    return rhs * lhs;
+}
+constexpr Color3 Color3::operator /(double rhs) const {
+    return Color3(r / rhs, g / rhs, b / rhs);
+}
+inline Color3 & Color3::operator +=(const Color3 & rhs) {
+    r += rhs.r;
+    g += rhs.g;
+    b += rhs.b;
+
+    return *this;
+}
+inline Color3 & Color3::operator -=(const Color3 & rhs) {
+    r -= rhs.r;
+    g -= rhs.g;
+    b -= rhs.b;
+
+    return *this;
+}
+inline Color3 & Color3::operator *=(double rhs) {
+    r *= rhs;
+    g *= rhs;
+    b *= rhs;
+
+    return *this;
+}
+inline Color3 & Color3::operator /=(double rhs) {
+    r /= rhs;
+    g /= rhs;
+    b /= rhs;
+
+    return *this;
+}
+constexpr bool Color3::operator ==(const Color3 & rhs) const {
+    return r == rhs.r && g == rhs.g && b == rhs.b;
+}
+constexpr bool Color3::operator !=(const Color3 & rhs) const {
+    return !(*this == rhs);
+}
+inline std::ostream & operator <<(std::ostream & lhs, const Color3 & rhs) {
+    return lhs << '(' << rhs.r << ' ' << rhs.g << ' ' << rhs.b << ')';
+}
+
+inline Color3 & Color3::applyGamma(double gamma) {
+    double t = 1.0 / gamma;
+
+    r = std::pow(r, t);
+    g = std::pow(g, t);
+    b = std::pow(b, t);
+
+    return *this;
+}
+inline Color3 & Color3::applyExposure(double exposure) {
+    double t = std::pow(2.0, exposure);
+
+    r *= t;
+    g *= t;
+    b *= t;
+
+    return *this;
+}
+inline Color3 & Color3::saturate() {
+    r = clamp(r, 0, 1.0);
+    g = clamp(g, 0, 1.0);
+    b = clamp(b, 0, 1.0);
+
+    return *this;
+}
+
+constexpr Color4::Color4() : r(0), g(0), b(0), a(0) {}
+constexpr Color4::Color4(double r, double g, double b, double a) : r(r), g(g), b(b), a(a) {}
+
+inline double & Color4::operator [](size_t i) {
+    return (&r)[i];
+}
+inline const double & Color4::operator [](size_t i) const {
+    return (&r)[i];
+}
+constexpr Color4 Color4::operator +() const {
+    return *this;
+}
+constexpr Color4 Color4::operator -() const {
+    return Color4(-r, -g, -b, a);
+}
+constexpr Color4 Color4::operator +(const Color4 & rhs) const {
+    return Color4(r + rhs.r, g + rhs.g, b + rhs.b, a);
+}
+constexpr Color4 Color4::operator -(const Color4 & rhs) const {
+    return Color4(r - rhs.r, g - rhs.g, b - rhs.b, a);
+}
+constexpr Color4 Color4::operator *(double rhs) const {
+    return Color4(r * rhs, g * rhs, b * rhs, a);
+}
+constexpr Color4 operator *(double lhs, const Color4 & rhs) {
+    return rhs * lhs;
+}
+constexpr Color4 Color4::operator /(double rhs) const {
+    return Color4(r / rhs, g / rhs, b / rhs, a);
+}
+inline Color4 & Color4::operator +=(const Color4 & rhs) {
+    r += rhs.r;
+    g += rhs.g;
+    b += rhs.b;
+
+    return *this;
+}
+inline Color4 & Color4::operator -=(const Color4 & rhs) {
+    r -= rhs.r;
+    g -= rhs.g;
+    b -= rhs.b;
+
+    return *this;
+}
+inline Color4 & Color4::operator *=(double rhs) {
+    r *= rhs;
+    g *= rhs;
+    b *= rhs;
+
+    return *this;
+}
+inline Color4 & Color4::operator /=(double rhs) {
+    r /= rhs;
+    g /= rhs;
+    b /= rhs;
+
+    return *this;
+}
+constexpr bool Color4::operator ==(const Color4 & rhs) const {
+    return r == rhs.r && g == rhs.g && b == rhs.b && a == rhs.a;
+}
+constexpr bool Color4::operator !=(const Color4 & rhs) const {
+    return !(*this == rhs);
+}
+inline std::ostream & operator <<(std::ostream & lhs, const Color4 & rhs) {
+    return lhs << '(' << rhs.r << ' ' << rhs.g << ' ' << rhs.b << ' ' << rhs.a << ')';
+}
+
+inline Color4 & Color4::applyGamma(double gamma) {
+    double t = 1.0 / gamma;
+
+    r = std::pow(r, t);
+    g = std::pow(g, t);
+    b = std::pow(b, t);
+
+    return *this;
+}
+inline Color4 & Color4::applyExposure(double exposure) {
+    double t = std::pow(2.0, exposure);
+
+    r *= t;
+    g *= t;
+    b *= t;
+
+    return *this;
+}
+inline Color4 & Color4::saturate() {
+    r = clamp(r, 0, 1.0);
+    g = clamp(g, 0, 1.0);
+    b = clamp(b, 0, 1.0);
+
+    return *this;
+}
+
+#endif
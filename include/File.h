@@ -0,0 +1,51 @@
+// File:    File.h
+// Author:  Danilo Peixoto
+// Date:    16/10/2026
+
+// Evita redefinição de símbolos do arquivo de cabeçalho (caso já tenha sido incluído)
+#ifndef CGC_FILE_H
+#define CGC_FILE_H
+
+#include <string>
+#include <cstddef>
+
+// Arquivo mapeado em memória somente para leitura (acesso direto sem cópia para memória do processo)
+class MappedFile {
+private:
+    const char * data; // Ponteiro para o conteúdo mapeado
+    size_t size; // Tamanho do arquivo em bytes
+    bool open; // Estado de abertura do arquivo
+
+#ifdef _WIN32
+    void * file; // Identificador do arquivo
+    void * mapping; // Identificador do mapeamento
+#else
+    int file; // Descritor do arquivo
+#endif
+
+public:
+    // Construtor padrão (arquivo fechado)
+    MappedFile();
+    // Construtor que abre arquivo
+    MappedFile(const std::string & filename);
+    // Destrutor padrão (fecha arquivo)
+    ~MappedFile();
+
+    // Impede cópia do mapeamento
+    MappedFile(const MappedFile &) = delete;
+    MappedFile & operator =(const MappedFile &) = delete;
+
+    // Retorna ponteiro para o início do conteúdo
+    const char * getData() const;
+    // Retorna tamanho do conteúdo em bytes
+    size_t getSize() const;
+    // Verifica se arquivo está aberto
+    bool isOpen() const;
+
+    // Mapeia arquivo em memória
+    bool load(const std::string & filename);
+    // Desfaz mapeamento e fecha arquivo
+    MappedFile & close();
+};
+
+#endif
@@ -0,0 +1,134 @@
+// File:    IndexBuffer.h
+// Author:  Danilo Peixoto
+// Date:    17/10/2026
+
+// Evita redefinição de símbolos do arquivo de cabeçalho (caso já tenha sido incluído)
+#ifndef CGC_INDEX_BUFFER_H
+#define CGC_INDEX_BUFFER_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Lista de índices armazenados com a menor largura capaz de representá-los (16, 32 bits ou "size_t")
+class IndexBuffer {
+private:
+    size_t width; // Largura de cada índice em bytes
+    std::vector<uint16_t> indices16; // Índices de 16 bits
+    std::vector<uint32_t> indices32; // Índices de 32 bits
+    std::vector<size_t> indices; // Índices de largura completa
+
+public:
+    // Construtor padrão (lista vazia de 16 bits)
+    IndexBuffer();
+    // Construtor para alocação de índices nulos com largura suficiente para "maximumIndex"
+    IndexBuffer(size_t size, size_t maximumIndex);
+    // Construtor por cópia de lista de índices (largura escolhida pelo maior índice)
+    IndexBuffer(const std::vector<size_t> & indices);
+    // Construtor que assume a memória da lista de índices (convertida se couber em largura menor)
+    IndexBuffer(std::vector<size_t> && indices);
+    // Construtor cópia
+    IndexBuffer(const IndexBuffer & indexBuffer);
+    // Construtor de movimentação (assume a memória da outra lista)
+    IndexBuffer(IndexBuffer && indexBuffer);
+    // Destrutor padrão
+    ~IndexBuffer();
+
+    // Sobrecarga da operação "listaA = listaB" (cópia)
+    IndexBuffer & operator =(const IndexBuffer & rhs);
+    // Sobrecarga da operação "listaA = listaB" (movimentação)
+    IndexBuffer & operator =(IndexBuffer && rhs);
+    // Sobrecarga da operação "índice = lista[i]"
+    size_t operator [](size_t i) const;
+    // Sobrecarga da operação "listaA == listaB" (compara valores independentemente da largura)
+    bool operator ==(const IndexBuffer & rhs) const;
+    // Sobrecarga da operação "listaA != listaB"
+    bool operator !=(const IndexBuffer & rhs) const;
+
+    // Configura índice (amplia largura se necessário)
+    IndexBuffer & set(size_t i, size_t index);
+    // Configura largura em bytes (2, 4 ou "sizeof(size_t)", nunca menor que a necessária)
+    IndexBuffer & setWidth(size_t width);
+    // Retorna índice
+    size_t get(size_t i) const;
+    // Retorna três índices consecutivos a partir de "i"
+    void get(size_t i, size_t & v0, size_t & v1, size_t & v2) const;
+    // Retorna largura de cada índice em bytes
+    size_t getWidth() const;
+    // Retorna número de índices
+    size_t getSize() const;
+    // Retorna tamanho da memória ocupada em bytes
+    size_t getMemorySize() const;
+    // Retorna ponteiro para os índices na largura atual
+    const void * getData() const;
+    // Retorna ponteiro modificável para os índices na largura atual
+    void * getData();
+    // Retorna maior índice armazenado (zero para lista vazia)
+    size_t getMaximum() const;
+    // Verifica se lista está vazia
+    bool isEmpty() const;
+
+    // Redimensiona lista (novos índices são nulos)
+    IndexBuffer & resize(size_t size);
+    // Remove todos índices
+    IndexBuffer & clear();
+    // Reduz largura ao mínimo necessário para os índices armazenados
+    IndexBuffer & compact();
+    // Reordena triângulos (grupos de três índices): triângulo "i" passa a ser o triângulo "order[i]"
+    IndexBuffer & reorderTriangles(const std::vector<size_t> & order);
+    // Substitui cada índice pela nova posição do elemento referenciado (índice "i" passa a ser "remap[i]")
+    IndexBuffer & remap(const std::vector<size_t> & remap);
+    // Devolve índices em largura completa ao chamador (lista resultante é vazia)
+    IndexBuffer & release(std::vector<size_t> & indices);
+
+    // Retorna menor largura em bytes capaz de representar "maximumIndex"
+    static size_t getRequiredWidth(size_t maximumIndex);
+};
+
+// Acesso aos índices é definido no cabeçalho para ser expandido em laços sobre triângulos
+inline size_t IndexBuffer::operator [](size_t i) const {
+    return get(i);
+}
+inline size_t IndexBuffer::get(size_t i) const {
+    if (width == 2)
+        return indices16[i];
+
+    if (width == 4)
+        return indices32[i];
+
+    return indices[i];
+}
+inline void IndexBuffer::get(size_t i, size_t & v0, size_t & v1, size_t & v2) const {
+    if (width == 2) {
+        v0 = indices16[i];
+        v1 = indices16[i + 1];
+        v2 = indices16[i + 2];
+    }
+    else if (width == 4) {
+        v0 = indices32[i];
+        v1 = indices32[i + 1];
+        v2 = indices32[i + 2];
+    }
+    else {
+        v0 = indices[i];
+        v1 = indices[i + 1];
+        v2 = indices[i + 2];
+    }
+}
+inline size_t IndexBuffer::getWidth() const {
+    return width;
+}
+inline size_t IndexBuffer::getSize() const {
+    if (width == 2)
+        return indices16.size();
+
+    if (width == 4)
+        return indices32.size();
+
+    return indices.size();
+}
+inline bool IndexBuffer::isEmpty() const {
+    return getSize() == 0;
+}
+
+#endif
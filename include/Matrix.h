@@ -1,267 +1,1128 @@
-// File:    Matrix.h
-// Author:  Danilo Peixoto
-// Date:    12/08/2018
-
-// Evita redefinio de smbolos do arquivo de cabealho (caso j tenha sido includo)
-#ifndef CGC_MATRIX_H
-#define CGC_MATRIX_H
-
-#include <ostream>
-
-// Declarao de tipo incompleto no cabealho evita dependncia cclica de arquivos
-class Vector2;
-class Vector3;
-
-// Matriz real 2x2
-class Matrix2 {
-private:
-    // Elementos da matriz
-    double m[2][2];
-
-public:
-    // Construtor padro (matriz zero)
-    Matrix2();
-    // Construtor cpia
-    Matrix2(const Matrix2 & matrix2);
-    // Construtor para valores iniciais
-    Matrix2(
-        double m00, double m01,
-        double m10, double m11);
-    // Destrutor padro
-    ~Matrix2();
-
-    // Sobrecarga da operao "matriz[i]" permite operao "matriz[i][j]" (retorno mutvel)
-    double * operator [](size_t i);
-    // Sobrecarga da operao "matriz[i]" permite operao "matriz[i][j]" (retorno imutvel)
-    const double * operator [](size_t i) const;
-    // Sobrecarga da operao "+matriz"
-    Matrix2 operator +() const;
-    // Sobrecarga da operao "-matriz"
-    Matrix2 operator -() const;
-    // Sobrecarga da operao "matrizA + matrizB"
-    Matrix2 operator +(const Matrix2 & rhs) const;
-    // Sobrecarga da operao "matrizA - matrizB"
-    Matrix2 operator -(const Matrix2 & rhs) const;
-    // Sobrecarga da operao "matrizA * matrizB"
-    Matrix2 operator *(const Matrix2 & rhs) const;
-    // Sobrecarga da operao "matriz * escalar"
-    Matrix2 operator *(double rhs) const;
-    // Sobrecarga da operao "escalar * matriz"
-    friend Matrix2 operator *(double lhs, const Matrix2 & rhs);
-    // Sobrecarga da operao "matrizA / matrizB" realiza operao "matrizA.inverse(matrizB)"
-    Matrix2 operator /(const Matrix2 & rhs) const;
-    // Sobrecarga da operao "matriz / escalar"
-    Matrix2 operator /(double rhs) const;
-    // Sobrecarga da operao "matrizA += matrizB"
-    Matrix2 & operator +=(const Matrix2 & rhs);
-    // Sobrecarga da operao "matrizA -= matrizB"
-    Matrix2 & operator -=(const Matrix2 & rhs);
-    // Sobrecarga da operao "matrizA *= matrizB"
-    Matrix2 & operator *=(const Matrix2 & rhs);
-    // Sobrecarga da operao "matriz *= escalar"
-    Matrix2 & operator *=(double rhs);
-    // Sobrecarga da operao "matrizA /= matrizB" realiza operao "matrizA = matrizA.inverse(matrizB)"
-    Matrix2 & operator /=(const Matrix2 & rhs);
-    // Sobrecarga da operao "matriz /= escalar"
-    Matrix2 & operator /=(double rhs);
-    // Sobrecarga da operao "matrizA == matrizB"
-    bool operator ==(const Matrix2 & rhs) const;
-    // Sobrecarga da operao "matrizA != matrizB"
-    bool operator !=(const Matrix2 & rhs) const;
-    // Sobrecarga da operao "sada << matriz" (imprimir sada de dados)
-    friend std::ostream & operator <<(std::ostream & lhs, const Matrix2 & rhs);
-
-    // Retorna determinante
-    double determinant() const;
-    // Retorna trao
-    double trace() const;
-    // Retorna menor da submatriz sem a linha "i" e coluna "j"
-    double minor(size_t i, size_t j) const;
-    // Transpe matriz (matriz transposta)
-    Matrix2 & transpose();
-    // Retorna inversa
-    Matrix2 inverse() const;
-    // Retorna adjunta
-    Matrix2 adjugate() const;
-};
-
-// Matriz real 3x3
-class Matrix3 {
-private:
-    // Elementos da matriz
-    double m[3][3];
-
-public:
-    // Construtor padro (matriz zero)
-    Matrix3();
-    // Construtor cpia
-    Matrix3(const Matrix3 & matrix3);
-    // Construtor para valores iniciais
-    Matrix3(
-        double m00, double m01, double m02,
-        double m10, double m11, double m12,
-        double m20, double m21, double m22);
-    // Destrutor padro
-    ~Matrix3();
-
-    // Sobrecarga da operao "matriz[i]" permite operao "matriz[i][j]" (retorno mutvel)
-    double * operator [](size_t i);
-    // Sobrecarga da operao "matriz[i]" permite operao "matriz[i][j]" (retorno imutvel)
-    const double * operator [](size_t i) const;
-    // Sobrecarga da operao "+matriz"
-    Matrix3 operator +() const;
-    // Sobrecarga da operao "-matriz"
-    Matrix3 operator -() const;
-    // Sobrecarga da operao "matrizA + matrizB"
-    Matrix3 operator +(const Matrix3 & rhs) const;
-    // Sobrecarga da operao "matrizA - matrizB"
-    Matrix3 operator -(const Matrix3 & rhs) const;
-    // Sobrecarga da operao "matrizA * matrizB"
-    Matrix3 operator *(const Matrix3 & rhs) const;
-    // Sobrecarga da operao "matriz * escalar"
-    Matrix3 operator *(double rhs) const;
-    // Sobrecarga da operao "escalar * matriz"
-    friend Matrix3 operator *(double lhs, const Matrix3 & rhs);
-    // Sobrecarga da operao "matrizA / matrizB" realiza operao "matrizA.inverse(matrizB)"
-    Matrix3 operator /(const Matrix3 & rhs) const;
-    // Sobrecarga da operao "matriz / escalar"
-    Matrix3 operator /(double rhs) const;
-    // Sobrecarga da operao "matrizA += matrizB"
-    Matrix3 & operator +=(const Matrix3 & rhs);
-    // Sobrecarga da operao "matrizA -= matrizB"
-    Matrix3 & operator -=(const Matrix3 & rhs);
-    // Sobrecarga da operao "matrizA *= matrizB"
-    Matrix3 & operator *=(const Matrix3 & rhs);
-    // Sobrecarga da operao "matriz *= escalar"
-    Matrix3 & operator *=(double rhs);
-    // Sobrecarga da operao "matrizA /= matrizB" realiza operao "matrizA = matrizA.inverse(matrizB)"
-    Matrix3 & operator /=(const Matrix3 & rhs);
-    // Sobrecarga da operao "matriz /= escalar"
-    Matrix3 & operator /=(double rhs);
-    // Sobrecarga da operao "matrizA == matrizB"
-    bool operator ==(const Matrix3 & rhs) const;
-    // Sobrecarga da operao "matrizA != matrizB"
-    bool operator !=(const Matrix3 & rhs) const;
-    // Sobrecarga da operao "sada << matriz" (imprimir sada de dados)
-    friend std::ostream & operator <<(std::ostream & lhs, const Matrix3 & rhs);
-
-    // Configura como matriz identidade
-    Matrix3 & setIdentity();
-    // Configura como matriz de translao "T" a partir dos deslocamentos "(dx, dy)"
-    Matrix3 & setTranslation(const Vector2 & translation);
-    // Configura como matriz de rotao "R" anti-horria a partir de um ngulo de Euler "a" em radiano
-    Matrix3 & setRotation(double rotation);
-    // Configura como matriz de escala "S" a partir dos fatores de escala "(sx, sy)"
-    Matrix3 & setScaling(const Vector2 & scaling);
-    // Configura como matriz de deformao "Sh" a partir dos componentes de deformao "(shx, shy)"
-    Matrix3 & setShearing(const Vector2 & shearing);
-    // Configura como matriz de transformao "M = S Sh R T"
-    Matrix3 & setTransformation(
-        const Vector2 & translation, double rotation,
-        const Vector2 & scaling, const Vector2 & shearing);
-
-    // Retorna determinante
-    double determinant() const;
-    // Retorna trao
-    double trace() const;
-    // Retorna menor da submatriz sem a linha "i" e coluna "j"
-    double minor(size_t i, size_t j) const;
-    // Transpe matriz (matriz transposta)
-    Matrix3 & transpose();
-    // Retorna inversa
-    Matrix3 inverse() const;
-    // Retorna adjunta
-    Matrix3 adjugate() const;
-};
-
-// Matriz real 4x4
-class Matrix4 {
-private:
-    // Elementos da matriz
-    double m[4][4];
-
-public:
-    // Construtor padro (matriz zero)
-    Matrix4();
-    // Construtor cpia
-    Matrix4(const Matrix4 & matrix4);
-    // Construtor para valores iniciais
-    Matrix4(
-        double m00, double m01, double m02, double m03,
-        double m10, double m11, double m12, double m13,
-        double m20, double m21, double m22, double m23,
-        double m30, double m31, double m32, double m33);
-    // Destrutor padro
-    ~Matrix4();
-
-    // Sobrecarga da operao "matriz[i]" permite operao "matriz[i][j]" (retorno mutvel)
-    double * operator [](size_t i);
-    // Sobrecarga da operao "matriz[i]" permite operao "matriz[i][j]" (retorno imutvel)
-    const double * operator [](size_t i) const;
-    // Sobrecarga da operao "+matriz"
-    Matrix4 operator +() const;
-    // Sobrecarga da operao "-matriz"
-    Matrix4 operator -() const;
-    // Sobrecarga da operao "matrizA + matrizB"
-    Matrix4 operator +(const Matrix4 & rhs) const;
-    // Sobrecarga da operao "matrizA - matrizB"
-    Matrix4 operator -(const Matrix4 & rhs) const;
-    // Sobrecarga da operao "matrizA * matrizB"
-    Matrix4 operator *(const Matrix4 & rhs) const;
-    // Sobrecarga da operao "matriz * escalar"
-    Matrix4 operator *(double rhs) const;
-    // Sobrecarga da operao "escalar * matriz"
-    friend Matrix4 operator *(double lhs, const Matrix4 & rhs);
-    // Sobrecarga da operao "matrizA / matrizB" realiza operao "matrizA.inverse(matrizB)"
-    Matrix4 operator /(const Matrix4 & rhs) const;
-    // Sobrecarga da operao "matriz / escalar"
-    Matrix4 operator /(double rhs) const;
-    // Sobrecarga da operao "matrizA += matrizB"
-    Matrix4 & operator +=(const Matrix4 & rhs);
-    // Sobrecarga da operao "matrizA -= matrizB"
-    Matrix4 & operator -=(const Matrix4 & rhs);
-    // Sobrecarga da operao "matrizA *= matrizB"
-    Matrix4 & operator *=(const Matrix4 & rhs);
-    // Sobrecarga da operao "matriz *= escalar"
-    Matrix4 & operator *=(double rhs);
-    // Sobrecarga da operao "matrizA /= matrizB" realiza operao "matrizA = matrizA.inverse(matrizB)"
-    Matrix4 & operator /=(const Matrix4 & rhs);
-    // Sobrecarga da operao "matriz /= escalar"
-    Matrix4 & operator /=(double rhs);
-    // Sobrecarga da operao "matrizA == matrizB"
-    bool operator ==(const Matrix4 & rhs) const;
-    // Sobrecarga da operao "matrizA != matrizB"
-    bool operator !=(const Matrix4 & rhs) const;
-    // Sobrecarga da operao "sada << matriz" (imprimir sada de dados)
-    friend std::ostream & operator <<(std::ostream & lhs, const Matrix4 & rhs);
-
-    // Configura como matriz identidade
-    Matrix4 & setIdentity();
-    // Configura como matriz de translao "T" a partir dos deslocamentos "(dx, dy, dz)"
-    Matrix4 & setTranslation(const Vector3 & translation);
-    // Configura como matriz de rotao "R = Rx Ry Rz" anti-horria a partir dos ngulos de Euler "(ax, ay, az)" em radiano
-    Matrix4 & setRotation(const Vector3 & rotation);
-    // Configura como matriz de escala "S" a partir dos fatores de escala "(sx, sy, sz)"
-    Matrix4 & setScaling(const Vector3 & scaling);
-    // Configura como matriz de deformao "Sh" a partir dos componentes de deformao "(shxy, shxz, shyz)"
-    Matrix4 & setShearing(const Vector3 & shearing);
-    // Configura como matriz de transformao "M = S Sh R T"
-    Matrix4 & setTransformation(
-        const Vector3 & translation, const Vector3 & rotation,
-        const Vector3 & scaling, const Vector3 & shearing);
-
-    // Retorna determinante
-    double determinant() const;
-    // Retorna trao
-    double trace() const;
-    // Retorna menor da submatriz sem a linha "i" e coluna "j"
-    double minor(size_t i, size_t j) const;
-    // Transpe matriz (matriz transposta)
-    Matrix4 & transpose();
-    // Retorna inversa
-    Matrix4 inverse() const;
-    // Retorna adjunta
-    Matrix4 adjugate() const;
-};
-
-#endif
\ No newline at end of file
+// File:    Matrix.h
+// Author:  Danilo Peixoto
+// Date:    12/08/2018
+
+// Evita redefinição de símbolos do arquivo de cabeçalho (caso já tenha sido incluído)
+#ifndef CGC_MATRIX_H
+#define CGC_MATRIX_H
+
+#include <Vector.h>
+
+#include <ostream>
+#include <cmath>
+
+
+// Matriz real 2x2
+class Matrix2 {
+private:
+    // Elementos da matriz
+    double m[2][2];
+
+public:
+    // Construtor padrão (matriz zero)
+    constexpr Matrix2();
+    // Construtor cópia (cópia trivial)
+    Matrix2(const Matrix2 & matrix2) = default;
+    // Construtor para valores iniciais
+    constexpr Matrix2(
+        double m00, double m01,
+        double m10, double m11);
+    // Destrutor padrão (trivial)
+    ~Matrix2() = default;
+
+    // Sobrecarga da operação "matriz[i]" permite operação "matriz[i][j]" (retorno mutável)
+    double * operator [](size_t i);
+    // Sobrecarga da operação "matriz[i]" permite operação "matriz[i][j]" (retorno imutável)
+    const double * operator [](size_t i) const;
+    // Sobrecarga da operação "+matriz"
+    Matrix2 operator +() const;
+    // Sobrecarga da operação "-matriz"
+    Matrix2 operator -() const;
+    // Sobrecarga da operação "matrizA + matrizB"
+    Matrix2 operator +(const Matrix2 & rhs) const;
+    // Sobrecarga da operação "matrizA - matrizB"
+    Matrix2 operator -(const Matrix2 & rhs) const;
+    // Sobrecarga da operação "matrizA * matrizB"
+    Matrix2 operator *(const Matrix2 & rhs) const;
+    // Sobrecarga da operação "matriz * escalar"
+    Matrix2 operator *(double rhs) const;
+    // Sobrecarga da operação "escalar * matriz"
+    friend Matrix2 operator *(double lhs, const Matrix2 & rhs);
+    // Sobrecarga da operação "matrizA / matrizB" realiza operação "matrizA.inverse(matrizB)"
+    Matrix2 operator /(const Matrix2 & rhs) const;
+    // Sobrecarga da operação "matriz / escalar"
+    Matrix2 operator /(double rhs) const;
+    // Sobrecarga da operação "matrizA += matrizB"
+    Matrix2 & operator +=(const Matrix2 & rhs);
+    // Sobrecarga da operação "matrizA -= matrizB"
+    Matrix2 & operator -=(const Matrix2 & rhs);
+    // Sobrecarga da operação "matrizA *= matrizB"
+    Matrix2 & operator *=(const Matrix2 & rhs);
+    // Sobrecarga da operação "matriz *= escalar"
+    Matrix2 & operator *=(double rhs);
+    // Sobrecarga da operação "matrizA /= matrizB" realiza operação "matrizA = matrizA.inverse(matrizB)"
+    Matrix2 & operator /=(const Matrix2 & rhs);
+    // Sobrecarga da operação "matriz /= escalar"
+    Matrix2 & operator /=(double rhs);
+    // Sobrecarga da operação "matrizA == matrizB"
+    bool operator ==(const Matrix2 & rhs) const;
+    // Sobrecarga da operação "matrizA != matrizB"
+    bool operator !=(const Matrix2 & rhs) const;
+    // Sobrecarga da operação "saída << matriz" (imprimir saída de dados)
+    friend std::ostream & operator <<(std::ostream & lhs, const Matrix2 & rhs);
+
+    // Retorna determinante
+    double determinant() const;
+    // Retorna traço
+    double trace() const;
+    // Retorna menor da submatriz sem a linha "i" e coluna "j"
+    double minor(size_t i, size_t j) const;
+    // Transpõe matriz (matriz transposta)
+    Matrix2 & transpose();
+    // Retorna inversa
+    Matrix2 inverse() const;
+    // Retorna adjunta
+    Matrix2 adjugate() const;
+};
+
+// Matriz real 3x3
+class Matrix3 {
+private:
+    // Elementos da matriz
+    double m[3][3];
+
+public:
+    // Construtor padrão (matriz zero)
+    constexpr Matrix3();
+    // Construtor cópia (cópia trivial)
+    Matrix3(const Matrix3 & matrix3) = default;
+    // Construtor para valores iniciais
+    constexpr Matrix3(
+        double m00, double m01, double m02,
+        double m10, double m11, double m12,
+        double m20, double m21, double m22);
+    // Destrutor padrão (trivial)
+    ~Matrix3() = default;
+
+    // Sobrecarga da operação "matriz[i]" permite operação "matriz[i][j]" (retorno mutável)
+    double * operator [](size_t i);
+    // Sobrecarga da operação "matriz[i]" permite operação "matriz[i][j]" (retorno imutável)
+    const double * operator [](size_t i) const;
+    // Sobrecarga da operação "+matriz"
+    Matrix3 operator +() const;
+    // Sobrecarga da operação "-matriz"
+    Matrix3 operator -() const;
+    // Sobrecarga da operação "matrizA + matrizB"
+    Matrix3 operator +(const Matrix3 & rhs) const;
+    // Sobrecarga da operação "matrizA - matrizB"
+    Matrix3 operator -(const Matrix3 & rhs) const;
+    // Sobrecarga da operação "matrizA * matrizB"
+    Matrix3 operator *(const Matrix3 & rhs) const;
+    // Sobrecarga da operação "matriz * escalar"
+    Matrix3 operator *(double rhs) const;
+    // Sobrecarga da operação "escalar * matriz"
+    friend Matrix3 operator *(double lhs, const Matrix3 & rhs);
+    // Sobrecarga da operação "matrizA / matrizB" realiza operação "matrizA.inverse(matrizB)"
+    Matrix3 operator /(const Matrix3 & rhs) const;
+    // Sobrecarga da operação "matriz / escalar"
+    Matrix3 operator /(double rhs) const;
+    // Sobrecarga da operação "matrizA += matrizB"
+    Matrix3 & operator +=(const Matrix3 & rhs);
+    // Sobrecarga da operação "matrizA -= matrizB"
+    Matrix3 & operator -=(const Matrix3 & rhs);
+    // Sobrecarga da operação "matrizA *= matrizB"
+    Matrix3 & operator *=(const Matrix3 & rhs);
+    // Sobrecarga da operação "matriz *= escalar"
+    Matrix3 & operator *=(double rhs);
+    // Sobrecarga da operação "matrizA /= matrizB" realiza operação "matrizA = matrizA.inverse(matrizB)"
+    Matrix3 & operator /=(const Matrix3 & rhs);
+    // Sobrecarga da operação "matriz /= escalar"
+    Matrix3 & operator /=(double rhs);
+    // Sobrecarga da operação "matrizA == matrizB"
+    bool operator ==(const Matrix3 & rhs) const;
+    // Sobrecarga da operação "matrizA != matrizB"
+    bool operator !=(const Matrix3 & rhs) const;
+    // Sobrecarga da operação "saída << matriz" (imprimir saída de dados)
+    friend std::ostream & operator <<(std::ostream & lhs, const Matrix3 & rhs);
+
+    // Configura como matriz identidade
+    Matrix3 & setIdentity();
+    // Configura como matriz de translação "T" a partir dos deslocamentos "(dx, dy)"
+    Matrix3 & setTranslation(const Vector2 & translation);
+    // Configura como matriz de rotação "R" anti-horária a partir de um ângulo de Euler "a" em radiano
+    Matrix3 & setRotation(double rotation);
+    // Configura como matriz de escala "S" a partir dos fatores de escala "(sx, sy)"
+    Matrix3 & setScaling(const Vector2 & scaling);
+    // Configura como matriz de deformação "Sh" a partir dos componentes de deformação "(shx, shy)"
+    Matrix3 & setShearing(const Vector2 & shearing);
+    // Configura como matriz de transformação "M = S Sh R T"
+    Matrix3 & setTransformation(
+        const Vector2 & translation, double rotation,
+        const Vector2 & scaling, const Vector2 & shearing);
+
+    // Retorna determinante
+    double determinant() const;
+    // Retorna traço
+    double trace() const;
+    // Retorna menor da submatriz sem a linha "i" e coluna "j"
+    double minor(size_t i, size_t j) const;
+    // Transpõe matriz (matriz transposta)
+    Matrix3 & transpose();
+    // Retorna inversa
+    Matrix3 inverse() const;
+    // Retorna adjunta
+    Matrix3 adjugate() const;
+};
+
+// Matriz real 4x4
+class Matrix4 {
+private:
+    // Elementos da matriz
+    double m[4][4];
+
+    // Determinantes 2x2 compartilhados pelo determinante, inversa e adjunta
+    struct Subdeterminants;
+
+public:
+    // Construtor padrão (matriz zero)
+    constexpr Matrix4();
+    // Construtor cópia (cópia trivial)
+    Matrix4(const Matrix4 & matrix4) = default;
+    // Construtor para valores iniciais
+    constexpr Matrix4(
+        double m00, double m01, double m02, double m03,
+        double m10, double m11, double m12, double m13,
+        double m20, double m21, double m22, double m23,
+        double m30, double m31, double m32, double m33);
+    // Destrutor padrão (trivial)
+    ~Matrix4() = default;
+
+    // Sobrecarga da operação "matriz[i]" permite operação "matriz[i][j]" (retorno mutável)
+    double * operator [](size_t i);
+    // Sobrecarga da operação "matriz[i]" permite operação "matriz[i][j]" (retorno imutável)
+    const double * operator [](size_t i) const;
+    // Sobrecarga da operação "+matriz"
+    Matrix4 operator +() const;
+    // Sobrecarga da operação "-matriz"
+    Matrix4 operator -() const;
+    // Sobrecarga da operação "matrizA + matrizB"
+    Matrix4 operator +(const Matrix4 & rhs) const;
+    // Sobrecarga da operação "matrizA - matrizB"
+    Matrix4 operator -(const Matrix4 & rhs) const;
+    // Sobrecarga da operação "matrizA * matrizB"
+    Matrix4 operator *(const Matrix4 & rhs) const;
+    // Sobrecarga da operação "matriz * escalar"
+    Matrix4 operator *(double rhs) const;
+    // Sobrecarga da operação "escalar * matriz"
+    friend Matrix4 operator *(double lhs, const Matrix4 & rhs);
+    // Sobrecarga da operação "matrizA / matrizB" realiza operação "matrizA.inverse(matrizB)"
+    Matrix4 operator /(const Matrix4 & rhs) const;
+    // Sobrecarga da operação "matriz / escalar"
+    Matrix4 operator /(double rhs) const;
+    // Sobrecarga da operação "matrizA += matrizB"
+    Matrix4 & operator +=(const Matrix4 & rhs);
+    // Sobrecarga da operação "matrizA -= matrizB"
+    Matrix4 & operator -=(const Matrix4 & rhs);
+    // Sobrecarga da operação "matrizA *= matrizB"
+    Matrix4 & operator *=(const Matrix4 & rhs);
+    // Sobrecarga da operação "matriz *= escalar"
+    Matrix4 & operator *=(double rhs);
+    // Sobrecarga da operação "matrizA /= matrizB" realiza operação "matrizA = matrizA.inverse(matrizB)"
+    Matrix4 & operator /=(const Matrix4 & rhs);
+    // Sobrecarga da operação "matriz /= escalar"
+    Matrix4 & operator /=(double rhs);
+    // Sobrecarga da operação "matrizA == matrizB"
+    bool operator ==(const Matrix4 & rhs) const;
+    // Sobrecarga da operação "matrizA != matrizB"
+    bool operator !=(const Matrix4 & rhs) const;
+    // Sobrecarga da operação "saída << matriz" (imprimir saída de dados)
+    friend std::ostream & operator <<(std::ostream & lhs, const Matrix4 & rhs);
+
+    // Configura como matriz identidade
+    Matrix4 & setIdentity();
+    // Configura como matriz de translação "T" a partir dos deslocamentos "(dx, dy, dz)"
+    Matrix4 & setTranslation(const Vector3 & translation);
+    // Configura como matriz de rotação "R = Rx Ry Rz" anti-horária a partir dos ângulos de Euler "(ax, ay, az)" em radiano
+    Matrix4 & setRotation(const Vector3 & rotation);
+    // Configura como matriz de escala "S" a partir dos fatores de escala "(sx, sy, sz)"
+    Matrix4 & setScaling(const Vector3 & scaling);
+    // Configura como matriz de deformação "Sh" a partir dos componentes de deformação "(shxy, shxz, shyz)"
+    Matrix4 & setShearing(const Vector3 & shearing);
+    // Configura como matriz de transformação "M = S Sh R T"
+    Matrix4 & setTransformation(
+        const Vector3 & translation, const Vector3 & rotation,
+        const Vector3 & scaling, const Vector3 & shearing);
+
+    // Retorna determinante
+    double determinant() const;
+    // Retorna traço
+    double trace() const;
+    // Retorna menor da submatriz sem a linha "i" e coluna "j"
+    double minor(size_t i, size_t j) const;
+    // Transpõe matriz (matriz transposta)
+    Matrix4 & transpose();
+    // Retorna inversa (cofatores calculados a partir de determinantes 2x2 compartilhados)
+    Matrix4 inverse() const;
+    // Retorna inversa de matriz afim (última coluna igual a (0, 0, 0, 1); somente a parte linear 3x3 é invertida)
+    Matrix4 affineInverse() const;
+    // Retorna adjunta
+    Matrix4 adjugate() const;
+    // Verifica se matriz é afim (última coluna igual a (0, 0, 0, 1))
+    bool isAffine() const;
+};
+
+// Determinantes 2x2 compartilhados pelos cofatores 4x4 (expansão de Laplace pelas duas primeiras e pelas
+// duas últimas linhas)
+struct Matrix4::Subdeterminants {
+    double s[6]; // Determinantes 2x2 das linhas 0 e 1
+    double c[6]; // Determinantes 2x2 das linhas 2 e 3
+
+    Subdeterminants(const Matrix4 & m) {
+        s[0] = m[0][0] * m[1][1] - m[1][0] * m[0][1];
+        s[1] = m[0][0] * m[1][2] - m[1][0] * m[0][2];
+        s[2] = m[0][0] * m[1][3] - m[1][0] * m[0][3];
+        s[3] = m[0][1] * m[1][2] - m[1][1] * m[0][2];
+        s[4] = m[0][1] * m[1][3] - m[1][1] * m[0][3];
+        s[5] = m[0][2] * m[1][3] - m[1][2] * m[0][3];
+
+        c[0] = m[2][0] * m[3][1] - m[3][0] * m[2][1];
+        c[1] = m[2][0] * m[3][2] - m[3][0] * m[2][2];
+        c[2] = m[2][0] * m[3][3] - m[3][0] * m[2][3];
+        c[3] = m[2][1] * m[3][2] - m[3][1] * m[2][2];
+        c[4] = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+        c[5] = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+    }
+
+    // Retorna determinante
+    double getDeterminant() const {
+        return s[0] * c[5] - s[1] * c[4] + s[2] * c[3] + s[3] * c[2] - s[4] * c[1] + s[5] * c[0];
+    }
+    // Retorna adjunta multiplicada pelo fator de escala
+    Matrix4 getAdjugate(const Matrix4 & m, double scale) const {
+        return Matrix4(
+            (m[1][1] * c[5] - m[1][2] * c[4] + m[1][3] * c[3]) * scale,
+            (-m[0][1] * c[5] + m[0][2] * c[4] - m[0][3] * c[3]) * scale,
+            (m[3][1] * s[5] - m[3][2] * s[4] + m[3][3] * s[3]) * scale,
+            (-m[2][1] * s[5] + m[2][2] * s[4] - m[2][3] * s[3]) * scale,
+
+            (-m[1][0] * c[5] + m[1][2] * c[2] - m[1][3] * c[1]) * scale,
+            (m[0][0] * c[5] - m[0][2] * c[2] + m[0][3] * c[1]) * scale,
+            (-m[3][0] * s[5] + m[3][2] * s[2] - m[3][3] * s[1]) * scale,
+            (m[2][0] * s[5] - m[2][2] * s[2] + m[2][3] * s[1]) * scale,
+
+            (m[1][0] * c[4] - m[1][1] * c[2] + m[1][3] * c[0]) * scale,
+            (-m[0][0] * c[4] + m[0][1] * c[2] - m[0][3] * c[0]) * scale,
+            (m[3][0] * s[4] - m[3][1] * s[2] + m[3][3] * s[0]) * scale,
+            (-m[2][0] * s[4] + m[2][1] * s[2] - m[2][3] * s[0]) * scale,
+
+            (-m[1][0] * c[3] + m[1][1] * c[1] - m[1][2] * c[0]) * scale,
+            (m[0][0] * c[3] - m[0][1] * c[1] + m[0][2] * c[0]) * scale,
+            (-m[3][0] * s[3] + m[3][1] * s[1] - m[3][2] * s[0]) * scale,
+            (m[2][0] * s[3] - m[2][1] * s[1] + m[2][2] * s[0]) * scale);
+    }
+};
+
+constexpr Matrix2::Matrix2() : m{} {}
+constexpr Matrix2::Matrix2(
+    double m00, double m01,
+    double m10, double m11)
+    : m{
+        {m00, m01},
+        {m10, m11}} {}
+
+inline double * Matrix2::operator [](size_t i) {
+    return m[i];
+}
+inline const double * Matrix2::operator [](size_t i) const {
+    return m[i];
+}
+inline Matrix2 Matrix2::operator +() const {
+    return *this;
+}
+inline Matrix2 Matrix2::operator -() const {
+    return Matrix2(
+        -m[0][0], -m[0][1],
+        -m[1][0], -m[1][1]);
+}
+inline Matrix2 Matrix2::operator +(const Matrix2 & rhs) const {
+    return Matrix2(*this) += rhs;
+}
+inline Matrix2 Matrix2::operator -(const Matrix2 & rhs) const {
+    return Matrix2(*this) -= rhs;
+}
+inline Matrix2 Matrix2::operator *(const Matrix2 & rhs) const {
+    return Matrix2(*this) *= rhs;
+}
+inline Matrix2 Matrix2::operator *(double rhs) const {
+    return Matrix2(*this) *= rhs;
+}
+inline Matrix2 operator *(double lhs, const Matrix2 & rhs) {
+    return rhs * lhs;
+}
+inline Matrix2 Matrix2::operator /(const Matrix2 & rhs) const {
+    return Matrix2(*this) /= rhs;
+}
+inline Matrix2 Matrix2::operator /(double rhs) const {
+    return Matrix2(*this) /= rhs;
+}
+inline Matrix2 & Matrix2::operator +=(const Matrix2 & rhs) {
+    m[0][0] += rhs[0][0]; m[0][1] += rhs[0][1];
+    m[1][0] += rhs[1][0]; m[1][1] += rhs[1][1];
+
+    return *this;
+}
+inline Matrix2 & Matrix2::operator -=(const Matrix2 & rhs) {
+    m[0][0] -= rhs[0][0]; m[0][1] -= rhs[0][1];
+    m[1][0] -= rhs[1][0]; m[1][1] -= rhs[1][1];
+
+    return *this;
+}
+inline Matrix2 & Matrix2::operator *=(const Matrix2 & rhs) {
+    double t0 = m[0][0], t1 = m[0][1];
+
+    m[0][0] = t0 * rhs[0][0] + t1 * rhs[1][0];
+    m[0][1] = t0 * rhs[0][1] + t1 * rhs[1][1];
+
+    t0 = m[1][0]; t1 = m[1][1];
+
+    m[1][0] = t0 * rhs[0][0] + t1 * rhs[1][0];
+    m[1][1] = t0 * rhs[0][1] + t1 * rhs[1][1];
+
+    return *this;
+}
+inline Matrix2 & Matrix2::operator *=(double rhs) {
+    m[0][0] *= rhs; m[0][1] *= rhs;
+    m[1][0] *= rhs; m[1][1] *= rhs;
+
+    return *this;
+}
+inline Matrix2 & Matrix2::operator /=(const Matrix2 & rhs) {
+    return *this *= rhs.inverse();
+}
+inline Matrix2 & Matrix2::operator /=(double rhs) {
+    m[0][0] /= rhs; m[0][1] /= rhs;
+    m[1][0] /= rhs; m[1][1] /= rhs;
+
+    return *this;
+}
+inline bool Matrix2::operator ==(const Matrix2 & rhs) const {
+    return m[0][0] == rhs[0][0] && m[0][1] == rhs[0][1]
+        && m[1][0] == rhs[1][0] && m[1][1] == rhs[1][1];
+}
+inline bool Matrix2::operator !=(const Matrix2 & rhs) const {
+    return !(*this == rhs);
+}
+inline std::ostream & operator <<(std::ostream & lhs, const Matrix2 & rhs) {
+    return lhs << '('
+        << rhs[0][0] << ' ' << rhs[0][1] << ' ' << std::endl
+        << rhs[1][0] << ' ' << rhs[1][1] << ')';
+}
+
+inline double Matrix2::determinant() const {
+    return m[0][0] * m[1][1] - m[0][1] * m[1][0];
+}
+inline double Matrix2::trace() const {
+    return m[0][0] + m[1][1];
+}
+inline double Matrix2::minor(size_t i, size_t j) const {
+    size_t i0 = i < 1 ? 1 : 0;
+    size_t j0 = j < 1 ? 1 : 0;
+
+    return m[i0][j0];
+}
+inline Matrix2 & Matrix2::transpose() {
+    double t01 = m[0][1];
+
+    m[0][1] = m[1][0];
+    m[1][0] = t01;
+
+    return *this;
+}
+inline Matrix2 Matrix2::inverse() const {
+    return adjugate() / determinant();
+}
+inline Matrix2 Matrix2::adjugate() const {
+    return Matrix2(
+        minor(0, 0), -minor(1, 0),
+        -minor(0, 1), minor(1, 1));
+}
+
+constexpr Matrix3::Matrix3() : m{} {}
+constexpr Matrix3::Matrix3(
+    double m00, double m01, double m02,
+    double m10, double m11, double m12,
+    double m20, double m21, double m22)
+    : m{
+        {m00, m01, m02},
+        {m10, m11, m12},
+        {m20, m21, m22}} {}
+
+inline double * Matrix3::operator [](size_t i) {
+    return m[i];
+}
+inline const double * Matrix3::operator [](size_t i) const {
+    return m[i];
+}
+inline Matrix3 Matrix3::operator +() const {
+    return *this;
+}
+inline Matrix3 Matrix3::operator -() const {
+    return Matrix3(
+        -m[0][0], -m[0][1], -m[0][2],
+        -m[1][0], -m[1][1], -m[1][2],
+        -m[2][0], -m[2][1], -m[2][2]);
+}
+inline Matrix3 Matrix3::operator +(const Matrix3 & rhs) const {
+    return Matrix3(*this) += rhs;
+}
+inline Matrix3 Matrix3::operator -(const Matrix3 & rhs) const {
+    return Matrix3(*this) -= rhs;
+}
+inline Matrix3 Matrix3::operator *(const Matrix3 & rhs) const {
+    return Matrix3(*this) *= rhs;
+}
+inline Matrix3 Matrix3::operator *(double rhs) const {
+    return Matrix3(*this) *= rhs;
+}
+inline Matrix3 operator *(double lhs, const Matrix3 & rhs) {
+    return rhs * lhs;
+}
+inline Matrix3 Matrix3::operator /(const Matrix3 & rhs) const {
+    return Matrix3(*this) /= rhs;
+}
+inline Matrix3 Matrix3::operator /(double rhs) const {
+    return Matrix3(*this) /= rhs;
+}
+inline Matrix3 & Matrix3::operator +=(const Matrix3 & rhs) {
+    m[0][0] += rhs[0][0]; m[0][1] += rhs[0][1]; m[0][2] += rhs[0][2];
+    m[1][0] += rhs[1][0]; m[1][1] += rhs[1][1]; m[1][2] += rhs[1][2];
+    m[2][0] += rhs[2][0]; m[2][1] += rhs[2][1]; m[2][2] += rhs[2][2];
+
+    return *this;
+}
+inline Matrix3 & Matrix3::operator -=(const Matrix3 & rhs) {
+    m[0][0] -= rhs[0][0]; m[0][1] -= rhs[0][1]; m[0][2] -= rhs[0][2];
+    m[1][0] -= rhs[1][0]; m[1][1] -= rhs[1][1]; m[1][2] -= rhs[1][2];
+    m[2][0] -= rhs[2][0]; m[2][1] -= rhs[2][1]; m[2][2] -= rhs[2][2];
+
+    return *this;
+}
+inline Matrix3 & Matrix3::operator *=(const Matrix3 & rhs) {
+    double t0 = m[0][0], t1 = m[0][1], t2 = m[0][2];
+
+    m[0][0] = t0 * rhs[0][0] + t1 * rhs[1][0] + t2 * rhs[2][0];
+    m[0][1] = t0 * rhs[0][1] + t1 * rhs[1][1] + t2 * rhs[2][1];
+    m[0][2] = t0 * rhs[0][2] + t1 * rhs[1][2] + t2 * rhs[2][2];
+
+    t0 = m[1][0]; t1 = m[1][1]; t2 = m[1][2];
+
+    m[1][0] = t0 * rhs[0][0] + t1 * rhs[1][0] + t2 * rhs[2][0];
+    m[1][1] = t0 * rhs[0][1] + t1 * rhs[1][1] + t2 * rhs[2][1];
+    m[1][2] = t0 * rhs[0][2] + t1 * rhs[1][2] + t2 * rhs[2][2];
+
+    t0 = m[2][0]; t1 = m[2][1]; t2 = m[2][2];
+
+    m[2][0] = t0 * rhs[0][0] + t1 * rhs[1][0] + t2 * rhs[2][0];
+    m[2][1] = t0 * rhs[0][1] + t1 * rhs[1][1] + t2 * rhs[2][1];
+    m[2][2] = t0 * rhs[0][2] + t1 * rhs[1][2] + t2 * rhs[2][2];
+
+    return *this;
+}
+inline Matrix3 & Matrix3::operator *=(double rhs) {
+    m[0][0] *= rhs; m[0][1] *= rhs; m[0][2] *= rhs;
+    m[1][0] *= rhs; m[1][1] *= rhs; m[1][2] *= rhs;
+    m[2][0] *= rhs; m[2][1] *= rhs; m[2][2] *= rhs;
+
+    return *this;
+}
+inline Matrix3 & Matrix3::operator /=(const Matrix3 & rhs) {
+    return *this *= rhs.inverse();
+}
+inline Matrix3 & Matrix3::operator /=(double rhs) {
+    m[0][0] /= rhs; m[0][1] /= rhs; m[0][2] /= rhs;
+    m[1][0] /= rhs; m[1][1] /= rhs; m[1][2] /= rhs;
+    m[2][0] /= rhs; m[2][1] /= rhs; m[2][2] /= rhs;
+
+    return *this;
+}
+inline bool Matrix3::operator ==(const Matrix3 & rhs) const {
+    return m[0][0] == rhs[0][0] && m[0][1] == rhs[0][1] && m[0][2] == rhs[0][2]
+        && m[1][0] == rhs[1][0] && m[1][1] == rhs[1][1] && m[1][2] == rhs[1][2]
+        && m[2][0] == rhs[2][0] && m[2][1] == rhs[2][1] && m[2][2] == rhs[2][2];
+}
+inline bool Matrix3::operator !=(const Matrix3 & rhs) const {
+    return !(*this == rhs);
+}
+inline std::ostream & operator <<(std::ostream & lhs, const Matrix3 & rhs) {
+    return lhs << '('
+        << rhs[0][0] << ' ' << rhs[0][1] << ' ' << rhs[0][2] << ' ' << std::endl
+        << rhs[1][0] << ' ' << rhs[1][1] << ' ' << rhs[1][2] << ' ' << std::endl
+        << rhs[2][0] << ' ' << rhs[2][1] << ' ' << rhs[2][2] << ')';
+}
+
+inline Matrix3 & Matrix3::setIdentity() {
+    m[0][0] = 1.0;
+    m[0][1] = 0;
+    m[0][2] = 0;
+
+    m[1][0] = 0;
+    m[1][1] = 1.0;
+    m[1][2] = 0;
+
+    m[2][0] = 0;
+    m[2][1] = 0;
+    m[2][2] = 1.0;
+
+    return *this;
+}
+inline Matrix3 & Matrix3::setTranslation(const Vector2 & translation) {
+    m[0][0] = 1.0;
+    m[0][1] = 0;
+    m[0][2] = 0;
+
+    m[1][0] = 0;
+    m[1][1] = 1.0;
+    m[1][2] = 0;
+
+    m[2][0] = translation.x;
+    m[2][1] = translation.y;
+    m[2][2] = 1.0;
+
+    return *this;
+}
+inline Matrix3 & Matrix3::setRotation(double rotation) {
+    double c = std::cos(rotation);
+    double s = std::sin(rotation);
+
+    m[0][0] = c;
+    m[0][1] = s;
+    m[0][2] = 0;
+
+    m[1][0] = -s;
+    m[1][1] = c;
+    m[1][2] = 0;
+
+    m[2][0] = 0;
+    m[2][1] = 0;
+    m[2][2] = 1.0;
+
+    return *this;
+}
+inline Matrix3 & Matrix3::setScaling(const Vector2 & scaling) {
+    m[0][0] = scaling.x;
+    m[0][1] = 0;
+    m[0][2] = 0;
+
+    m[1][0] = 0;
+    m[1][1] = scaling.y;
+    m[1][2] = 0;
+
+    m[2][0] = 0;
+    m[2][1] = 0;
+    m[2][2] = 1.0;
+
+    return *this;
+}
+inline Matrix3 & Matrix3::setShearing(const Vector2 & shearing) {
+    m[0][0] = 1.0;
+    m[0][1] = shearing.y;
+    m[0][2] = 0;
+
+    m[1][0] = shearing.x;
+    m[1][1] = 1.0;
+    m[1][2] = 0;
+
+    m[2][0] = 0;
+    m[2][1] = 0;
+    m[2][2] = 1.0;
+
+    return *this;
+}
+inline Matrix3 & Matrix3::setTransformation(
+    const Vector2 & translation, double rotation,
+    const Vector2 & scaling, const Vector2 & shearing) {
+    double c = std::cos(rotation);
+    double s = std::sin(rotation);
+
+    m[0][0] = (c - s * shearing.x) * scaling.x;
+    m[0][1] = (s + c * shearing.x) * scaling.x;
+    m[0][2] = 0;
+
+    m[1][0] = (c * shearing.y - s) * scaling.y;
+    m[1][1] = (c + s * shearing.y) * scaling.y;
+    m[1][2] = 0;
+
+    m[2][0] = translation.x;
+    m[2][1] = translation.y;
+    m[2][2] = 1.0;
+
+    return *this;
+}
+
+inline double Matrix3::determinant() const {
+    return m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1])
+        + m[0][1] * (m[1][2] * m[2][0] - m[1][0] * m[2][2])
+        + m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+}
+inline double Matrix3::trace() const {
+    return m[0][0] + m[1][1] + m[2][2];
+}
+inline double Matrix3::minor(size_t i, size_t j) const {
+    size_t i0 = i < 1 ? 1 : 0;
+    size_t i1 = i < 2 ? 2 : 1;
+
+    size_t j0 = j < 1 ? 1 : 0;
+    size_t j1 = j < 2 ? 2 : 1;
+
+    return m[i0][j0] * m[i1][j1] - m[i0][j1] * m[i1][j0];
+}
+inline Matrix3 & Matrix3::transpose() {
+    Matrix3 t(*this);
+
+    m[0][1] = t[1][0]; m[0][2] = t[2][0];
+    m[1][0] = t[0][1]; m[1][2] = t[2][1];
+    m[2][0] = t[0][2]; m[2][1] = t[1][2];
+
+    return *this;
+}
+inline Matrix3 Matrix3::inverse() const {
+    return adjugate() / determinant();
+}
+inline Matrix3 Matrix3::adjugate() const {
+    return Matrix3(
+        minor(0, 0), -minor(1, 0), minor(2, 0),
+        -minor(0, 1), minor(1, 1), -minor(2, 1),
+        minor(0, 2), -minor(1, 2), minor(2, 2));
+}
+
+constexpr Matrix4::Matrix4() : m{} {}
+constexpr Matrix4::Matrix4(
+    double m00, double m01, double m02, double m03,
+    double m10, double m11, double m12, double m13,
+    double m20, double m21, double m22, double m23,
+    double m30, double m31, double m32, double m33)
+    : m{
+        {m00, m01, m02, m03},
+        {m10, m11, m12, m13},
+        {m20, m21, m22, m23},
+        {m30, m31, m32, m33}} {}
+
+inline double * Matrix4::operator [](size_t i) {
+    return m[i];
+}
+inline const double * Matrix4::operator [](size_t i) const {
+    return m[i];
+}
+inline Matrix4 Matrix4::operator +() const {
+    return *this;
+}
+inline Matrix4 Matrix4::operator -() const {
+    return Matrix4(
+        -m[0][0], -m[0][1], -m[0][2], -m[0][3],
+        -m[1][0], -m[1][1], -m[1][2], -m[1][3],
+        -m[2][0], -m[2][1], -m[2][2], -m[2][3],
+        -m[3][0], -m[3][1], -m[3][2], -m[3][3]);
+}
+inline Matrix4 Matrix4::operator +(const Matrix4 & rhs) const {
+    return Matrix4(*this) += rhs;
+}
+inline Matrix4 Matrix4::operator -(const Matrix4 & rhs) const {
+    return Matrix4(*this) -= rhs;
+}
+inline Matrix4 Matrix4::operator *(const Matrix4 & rhs) const {
+    return Matrix4(*this) *= rhs;
+}
+inline Matrix4 Matrix4::operator *(double rhs) const {
+    return Matrix4(*this) *= rhs;
+}
+inline Matrix4 operator *(double lhs, const Matrix4 & rhs) {
+    return rhs * lhs;
+}
+inline Matrix4 Matrix4::operator /(const Matrix4 & rhs) const {
+    return Matrix4(*this) /= rhs;
+}
+inline Matrix4 Matrix4::operator /(double rhs) const {
+    return Matrix4(*this) /= rhs;
+}
+inline Matrix4 & Matrix4::operator +=(const Matrix4 & rhs) {
+    m[0][0] += rhs[0][0]; m[0][1] += rhs[0][1]; m[0][2] += rhs[0][2]; m[0][3] += rhs[0][3];
+    m[1][0] += rhs[1][0]; m[1][1] += rhs[1][1]; m[1][2] += rhs[1][2]; m[1][3] += rhs[1][3];
+    m[2][0] += rhs[2][0]; m[2][1] += rhs[2][1]; m[2][2] += rhs[2][2]; m[2][3] += rhs[2][3];
+    m[3][0] += rhs[3][0]; m[3][1] += rhs[3][1]; m[3][2] += rhs[3][2]; m[3][3] += rhs[3][3];
+
+    return *this;
+}
+inline Matrix4 & Matrix4::operator -=(const Matrix4 & rhs) {
+    m[0][0] -= rhs[0][0]; m[0][1] -= rhs[0][1]; m[0][2] -= rhs[0][2]; m[0][3] -= rhs[0][3];
+    m[1][0] -= rhs[1][0]; m[1][1] -= rhs[1][1]; m[1][2] -= rhs[1][2]; m[1][3] -= rhs[1][3];
+    m[2][0] -= rhs[2][0]; m[2][1] -= rhs[2][1]; m[2][2] -= rhs[2][2]; m[2][3] -= rhs[2][3];
+    m[3][0] -= rhs[3][0]; m[3][1] -= rhs[3][1]; m[3][2] -= rhs[3][2]; m[3][3] -= rhs[3][3];
+
+    return *this;
+}
+inline Matrix4 & Matrix4::operator *=(const Matrix4 & rhs) {
+    double t0 = m[0][0], t1 = m[0][1], t2 = m[0][2], t3 = m[0][3];
+
+    m[0][0] = t0 * rhs[0][0] + t1 * rhs[1][0] + t2 * rhs[2][0] + t3 * rhs[3][0];
+    m[0][1] = t0 * rhs[0][1] + t1 * rhs[1][1] + t2 * rhs[2][1] + t3 * rhs[3][1];
+    m[0][2] = t0 * rhs[0][2] + t1 * rhs[1][2] + t2 * rhs[2][2] + t3 * rhs[3][2];
+    m[0][3] = t0 * rhs[0][3] + t1 * rhs[1][3] + t2 * rhs[2][3] + t3 * rhs[3][3];
+
+    t0 = m[1][0]; t1 = m[1][1]; t2 = m[1][2]; t3 = m[1][3];
+
+    m[1][0] = t0 * rhs[0][0] + t1 * rhs[1][0] + t2 * rhs[2][0] + t3 * rhs[3][0];
+    m[1][1] = t0 * rhs[0][1] + t1 * rhs[1][1] + t2 * rhs[2][1] + t3 * rhs[3][1];
+    m[1][2] = t0 * rhs[0][2] + t1 * rhs[1][2] + t2 * rhs[2][2] + t3 * rhs[3][2];
+    m[1][3] = t0 * rhs[0][3] + t1 * rhs[1][3] + t2 * rhs[2][3] + t3 * rhs[3][3];
+
+    t0 = m[2][0]; t1 = m[2][1]; t2 = m[2][2]; t3 = m[2][3];
+
+    m[2][0] = t0 * rhs[0][0] + t1 * rhs[1][0] + t2 * rhs[2][0] + t3 * rhs[3][0];
+    m[2][1] = t0 * rhs[0][1] + t1 * rhs[1][1] + t2 * rhs[2][1] + t3 * rhs[3][1];
+    m[2][2] = t0 * rhs[0][2] + t1 * rhs[1][2] + t2 * rhs[2][2] + t3 * rhs[3][2];
+    m[2][3] = t0 * rhs[0][3] + t1 * rhs[1][3] + t2 * rhs[2][3] + t3 * rhs[3][3];
+
+    t0 = m[3][0]; t1 = m[3][1]; t2 = m[3][2]; t3 = m[3][3];
+
+    m[3][0] = t0 * rhs[0][0] + t1 * rhs[1][0] + t2 * rhs[2][0] + t3 * rhs[3][0];
+    m[3][1] = t0 * rhs[0][1] + t1 * rhs[1][1] + t2 * rhs[2][1] + t3 * rhs[3][1];
+    m[3][2] = t0 * rhs[0][2] + t1 * rhs[1][2] + t2 * rhs[2][2] + t3 * rhs[3][2];
+    m[3][3] = t0 * rhs[0][3] + t1 * rhs[1][3] + t2 * rhs[2][3] + t3 * rhs[3][3];
+
+    return *this;
+}
+inline Matrix4 & Matrix4::operator *=(double rhs) {
+    m[0][0] *= rhs; m[0][1] *= rhs; m[0][2] *= rhs; m[0][3] *= rhs;
+    m[1][0] *= rhs; m[1][1] *= rhs; m[1][2] *= rhs; m[1][3] *= rhs;
+    m[2][0] *= rhs; m[2][1] *= rhs; m[2][2] *= rhs; m[2][3] *= rhs;
+    m[3][0] *= rhs; m[3][1] *= rhs; m[3][2] *= rhs; m[3][3] *= rhs;
+
+    return *this;
+}
+inline Matrix4 & Matrix4::operator /=(const Matrix4 & rhs) {
+    return *this *= rhs.inverse();
+}
+inline Matrix4 & Matrix4::operator /=(double rhs) {
+    m[0][0] /= rhs; m[0][1] /= rhs; m[0][2] /= rhs; m[0][3] /= rhs;
+    m[1][0] /= rhs; m[1][1] /= rhs; m[1][2] /= rhs; m[1][3] /= rhs;
+    m[2][0] /= rhs; m[2][1] /= rhs; m[2][2] /= rhs; m[2][3] /= rhs;
+    m[3][0] /= rhs; m[3][1] /= rhs; m[3][2] /= rhs; m[3][3] /= rhs;
+
+    return *this;
+}
+inline bool Matrix4::operator ==(const Matrix4 & rhs) const {
+    return m[0][0] == rhs[0][0] && m[0][1] == rhs[0][1] && m[0][2] == rhs[0][2] && m[0][3] == rhs[0][3]
+        && m[1][0] == rhs[1][0] && m[1][1] == rhs[1][1] && m[1][2] == rhs[1][2] && m[1][3] == rhs[1][3]
+        && m[2][0] == rhs[2][0] && m[2][1] == rhs[2][1] && m[2][2] == rhs[2][2] && m[2][3] == rhs[2][3]
+        && m[3][0] == rhs[3][0] && m[3][1] == rhs[3][1] && m[3][2] == rhs[3][2] && m[3][3] == rhs[3][3];
+}
+inline bool Matrix4::operator !=(const Matrix4 & rhs) const {
+    return !(*this == rhs);
+}
+inline std::ostream & operator <<(std::ostream & lhs, const Matrix4 & rhs) {
+    return lhs << '('
+        << rhs[0][0] << ' ' << rhs[0][1] << ' ' << rhs[0][2] << ' ' << rhs[0][3] << ' ' << std::endl
+        << rhs[1][0] << ' ' << rhs[1][1] << ' ' << rhs[1][2] << ' ' << rhs[1][3] << ' ' << std::endl
+        << rhs[2][0] << ' ' << rhs[2][1] << ' ' << rhs[2][2] << ' ' << rhs[2][3] << ' ' << std::endl
+        << rhs[3][0] << ' ' << rhs[3][1] << ' ' << rhs[3][2] << ' ' << rhs[3][3] << ')';
+}
+
+inline Matrix4 & Matrix4::setIdentity() {
+    m[0][0] = 1.0;
+    m[0][1] = 0;
+    m[0][2] = 0;
+    m[0][3] = 0;
+
+    m[1][0] = 0;
+    m[1][1] = 1.0;
+    m[1][2] = 0;
+    m[1][3] = 0;
+
+    m[2][0] = 0;
+    m[2][1] = 0;
+    m[2][2] = 1.0;
+    m[2][3] = 0;
+
+    m[3][0] = 0;
+    m[3][1] = 0;
+    m[3][2] = 0;
+    m[3][3] = 1.0;
+
+    return *this;
+}
+inline Matrix4 & Matrix4::setTranslation(const Vector3 & translation) {
+    m[0][0] = 1.0;
+    m[0][1] = 0;
+    m[0][2] = 0;
+    m[0][3] = 0;
+
+    m[1][0] = 0;
+    m[1][1] = 1.0;
+    m[1][2] = 0;
+    m[1][3] = 0;
+
+    m[2][0] = 0;
+    m[2][1] = 0;
+    m[2][2] = 1.0;
+    m[2][3] = 0;
+
+    m[3][0] = translation.x;
+    m[3][1] = translation.y;
+    m[3][2] = translation.z;
+    m[3][3] = 1.0;
+
+    return *this;
+}
+inline Matrix4 & Matrix4::setRotation(const Vector3 & rotation) {
+    double cx = std::cos(rotation.x);
+    double cy = std::cos(rotation.y);
+    double cz = std::cos(rotation.z);
+
+    double sx = std::sin(rotation.x);
+    double sy = std::sin(rotation.y);
+    double sz = std::sin(rotation.z);
+
+    m[0][0] = cy * cz;
+    m[0][1] = cy * sz;
+    m[0][2] = -sy;
+    m[0][3] = 0;
+
+    m[1][0] = cz * sx * sy - cx * sz;
+    m[1][1] = cx * cz + sx * sy * sz;
+    m[1][2] = cy * sx;
+    m[1][3] = 0;
+
+    m[2][0] = cx * cz * sy + sx * sz;
+    m[2][1] = cx * sy * sz - cz * sx;
+    m[2][2] = cx * cy;
+    m[2][3] = 0;
+
+    m[3][0] = 0;
+    m[3][1] = 0;
+    m[3][2] = 0;
+    m[3][3] = 1.0;
+
+    return *this;
+}
+inline Matrix4 & Matrix4::setScaling(const Vector3 & scaling) {
+    m[0][0] = scaling.x;
+    m[0][1] = 0;
+    m[0][2] = 0;
+    m[0][3] = 0;
+
+    m[1][0] = 0;
+    m[1][1] = scaling.y;
+    m[1][2] = 0;
+    m[1][3] = 0;
+
+    m[2][0] = 0;
+    m[2][1] = 0;
+    m[2][2] = scaling.z;
+    m[2][3] = 0;
+
+    m[3][0] = 0;
+    m[3][1] = 0;
+    m[3][2] = 0;
+    m[3][3] = 1.0;
+
+    return *this;
+}
+inline Matrix4 & Matrix4::setShearing(const Vector3 & shearing) {
+    m[0][0] = 1.0;
+    m[0][1] = 0;
+    m[0][2] = 0;
+    m[0][3] = 0;
+
+    m[1][0] = shearing.x;
+    m[1][1] = 1.0;
+    m[1][2] = 0;
+    m[1][3] = 0;
+
+    m[2][0] = shearing.y;
+    m[2][1] = shearing.z;
+    m[2][2] = 1.0;
+    m[2][3] = 0;
+
+    m[3][0] = 0;
+    m[3][1] = 0;
+    m[3][2] = 0;
+    m[3][3] = 1.0;
+
+    return *this;
+}
+inline Matrix4 & Matrix4::setTransformation(
+    const Vector3 & translation, const Vector3 & rotation,
+    const Vector3 & scaling, const Vector3 & shearing) {
+    double cx = std::cos(rotation.x);
+    double cy = std::cos(rotation.y);
+    double cz = std::cos(rotation.z);
+
+    double sx = std::sin(rotation.x);
+    double sy = std::sin(rotation.y);
+    double sz = std::sin(rotation.z);
+
+    m[0][0] = cy * cz * scaling.x;
+    m[0][1] = cy * sz * scaling.x;
+    m[0][2] = -sy * scaling.x;
+    m[0][3] = 0;
+
+    m[1][0] = (cz * sx * sy - cx * sz + cy * cz * shearing.x) * scaling.y;
+    m[1][1] = (cx * cz + sx * sy * sz + cy * sz * shearing.x) * scaling.y;
+    m[1][2] = (cy * sx - sy * shearing.x) * scaling.y;
+    m[1][3] = 0;
+
+    double t0 = cz * sx * sy - cx * sz;
+    double t1 = cx * cz * sy + sx * sz;
+    double t2 = cx * cz + sx * sy * sz;
+    double t3 = cx * sy * sz - cz * sx;
+
+    m[2][0] = (cy * cz * shearing.y + t0 * shearing.z + t1) * scaling.z;
+    m[2][1] = (cy * sz * shearing.y + t2 * shearing.z + t3) * scaling.z;
+    m[2][2] = (cx * cy - sy * shearing.y + cy * sx * shearing.z) * scaling.z;
+    m[2][3] = 0;
+
+    m[3][0] = translation.x;
+    m[3][1] = translation.y;
+    m[3][2] = translation.z;
+    m[3][3] = 1.0;
+
+    return *this;
+}
+
+inline double Matrix4::determinant() const {
+    return Subdeterminants(*this).getDeterminant();
+}
+inline double Matrix4::trace() const {
+    return m[0][0] + m[1][1] + m[2][2] + m[3][3];
+}
+inline double Matrix4::minor(size_t i, size_t j) const {
+    size_t i0 = i < 1 ? 1 : 0;
+    size_t i1 = i < 2 ? 2 : 1;
+    size_t i2 = i < 3 ? 3 : 2;
+
+    size_t j0 = j < 1 ? 1 : 0;
+    size_t j1 = j < 2 ? 2 : 1;
+    size_t j2 = j < 3 ? 3 : 2;
+
+    return m[i0][j0] * (m[i1][j1] * m[i2][j2] - m[i1][j2] * m[i2][j1])
+        + m[i0][j1] * (m[i1][j2] * m[i2][j0] - m[i1][j0] * m[i2][j2])
+        + m[i0][j2] * (m[i1][j0] * m[i2][j1] - m[i1][j1] * m[i2][j0]);
+}
+inline Matrix4 & Matrix4::transpose() {
+    Matrix4 t(*this);
+
+    m[0][1] = t[1][0]; m[0][2] = t[2][0]; m[0][3] = t[3][0];
+    m[1][0] = t[0][1]; m[1][2] = t[2][1]; m[1][3] = t[3][1];
+    m[2][0] = t[0][2]; m[2][1] = t[1][2]; m[2][3] = t[3][2];
+    m[3][0] = t[0][3]; m[3][1] = t[1][3]; m[3][2] = t[2][3];
+
+    return *this;
+}
+inline Matrix4 Matrix4::inverse() const {
+    Subdeterminants subdeterminants(*this);
+    return subdeterminants.getAdjugate(*this, 1.0 / subdeterminants.getDeterminant());
+}
+inline Matrix4 Matrix4::affineInverse() const {
+    // Inversa da parte linear "A" por cofatores 3x3 e translação "-t A^-1"
+    double c0 = m[1][1] * m[2][2] - m[1][2] * m[2][1];
+    double c1 = m[1][2] * m[2][0] - m[1][0] * m[2][2];
+    double c2 = m[1][0] * m[2][1] - m[1][1] * m[2][0];
+    double r = 1.0 / (m[0][0] * c0 + m[0][1] * c1 + m[0][2] * c2);
+
+    Matrix4 result(
+        c0 * r, (m[0][2] * m[2][1] - m[0][1] * m[2][2]) * r, (m[0][1] * m[1][2] - m[0][2] * m[1][1]) * r, 0,
+        c1 * r, (m[0][0] * m[2][2] - m[0][2] * m[2][0]) * r, (m[0][2] * m[1][0] - m[0][0] * m[1][2]) * r, 0,
+        c2 * r, (m[0][1] * m[2][0] - m[0][0] * m[2][1]) * r, (m[0][0] * m[1][1] - m[0][1] * m[1][0]) * r, 0,
+        0, 0, 0, 1);
+
+    for (size_t j = 0; j < 3; j++)
+        result[3][j] = -(m[3][0] * result[0][j] + m[3][1] * result[1][j] + m[3][2] * result[2][j]);
+
+    return result;
+}
+inline Matrix4 Matrix4::adjugate() const {
+    return Subdeterminants(*this).getAdjugate(*this, 1.0);
+}
+inline bool Matrix4::isAffine() const {
+    return m[0][3] == 0 && m[1][3] == 0 && m[2][3] == 0 && m[3][3] == 1;
+}
+
+inline Vector2 Vector2::operator *(const Matrix2 & rhs) const {
+    return Vector2(*this) *= rhs;
+}
+inline Vector2 operator *(const Matrix2 & lhs, const Vector2 & rhs) {
+    return Vector2(
+        rhs.x * lhs[0][0] + rhs.y * lhs[0][1],
+        rhs.x * lhs[1][0] + rhs.y * lhs[1][1]);
+}
+inline Vector2 Vector2::operator *(const Matrix3 & rhs) const {
+    return Vector2(*this) *= rhs;
+}
+inline Vector2 operator *(const Matrix3 & lhs, const Vector2 & rhs) {
+    return Vector2(
+        rhs.x * lhs[0][0] + rhs.y * lhs[0][1] + lhs[0][2],
+        rhs.x * lhs[1][0] + rhs.y * lhs[1][1] + lhs[1][2]);
+}
+inline Vector2 & Vector2::operator *=(const Matrix2 & rhs) {
+    double t = x;
+
+    x = x * rhs[0][0] + y * rhs[1][0];
+    y = t * rhs[0][1] + y * rhs[1][1];
+
+    return *this;
+}
+inline Vector2 & Vector2::operator *=(const Matrix3 & rhs) {
+    double t = x;
+
+    x = x * rhs[0][0] + y * rhs[1][0] + rhs[2][0];
+    y = t * rhs[0][1] + y * rhs[1][1] + rhs[2][1];
+
+    return *this;
+}
+inline Vector3 Vector3::operator *(const Matrix3 & rhs) const {
+    return Vector3(*this) *= rhs;
+}
+inline Vector3 operator *(const Matrix3 & lhs, const Vector3 & rhs) {
+    return Vector3(
+        rhs.x * lhs[0][0] + rhs.y * lhs[0][1] + rhs.z * lhs[0][2],
+        rhs.x * lhs[1][0] + rhs.y * lhs[1][1] + rhs.z * lhs[1][2],
+        rhs.x * lhs[2][0] + rhs.y * lhs[2][1] + rhs.z * lhs[2][2]);
+}
+inline Vector3 Vector3::operator *(const Matrix4 & rhs) const {
+    return Vector3(*this) *= rhs;
+}
+inline Vector3 operator *(const Matrix4 & lhs, const Vector3 & rhs) {
+    return Vector3(
+        rhs.x * lhs[0][0] + rhs.y * lhs[0][1] + rhs.z * lhs[0][2] + lhs[0][3],
+        rhs.x * lhs[1][0] + rhs.y * lhs[1][1] + rhs.z * lhs[1][2] + lhs[1][3],
+        rhs.x * lhs[2][0] + rhs.y * lhs[2][1] + rhs.z * lhs[2][2] + lhs[2][3]);
+}
+inline Vector3 & Vector3::operator *=(const Matrix3 & rhs) {
+    Vector3 t(*this);
+
+    x = t.x * rhs[0][0] + t.y * rhs[1][0] + t.z * rhs[2][0];
+    y = t.x * rhs[0][1] + t.y * rhs[1][1] + t.z * rhs[2][1];
+    z = t.x * rhs[0][2] + t.y * rhs[1][2] + t.z * rhs[2][2];
+
+    return *this;
+}
+inline Vector3 & Vector3::operator *=(const Matrix4 & rhs) {
+    Vector3 t(*this);
+
+    x = t.x * rhs[0][0] + t.y * rhs[1][0] + t.z * rhs[2][0] + rhs[3][0];
+    y = t.x * rhs[0][1] + t.y * rhs[1][1] + t.z * rhs[2][1] + rhs[3][1];
+    z = t.x * rhs[0][2] + t.y * rhs[1][2] + t.z * rhs[2][2] + rhs[3][2];
+
+    return *this;
+}
+inline Vector3f & Vector3f::operator *=(const Matrix4 & rhs) {
+    Vector3f t(*this);
+
+    x = (float)(t.x * rhs[0][0] + t.y * rhs[1][0] + t.z * rhs[2][0] + rhs[3][0]);
+    y = (float)(t.x * rhs[0][1] + t.y * rhs[1][1] + t.z * rhs[2][1] + rhs[3][1]);
+    z = (float)(t.x * rhs[0][2] + t.y * rhs[1][2] + t.z * rhs[2][2] + rhs[3][2]);
+
+    return *this;
+}
+
+#endif
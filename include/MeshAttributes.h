@@ -0,0 +1,33 @@
+// File:    MeshAttributes.h
+// Author:  Danilo Peixoto
+// Date:    17/10/2026
+
+// Evita redefinição de símbolos do arquivo de cabeçalho (caso já tenha sido incluído)
+#ifndef CGC_MESH_ATTRIBUTES_H
+#define CGC_MESH_ATTRIBUTES_H
+
+#include <Global.h>
+
+#include <cstddef>
+
+// Declaração de tipo incompleto no cabeçalho evita dependência cíclica de arquivos
+class TriangleMesh;
+class TriangleMeshf;
+
+// Gera vetores normais suaves por vértice substituindo os existentes (soma dos vetores normais dos triângulos
+// adjacentes ponderados pelo ângulo do canto ou pela área); arestas entre triângulos que formam ângulo maior
+// que "creaseAngle" radianos são vincos que separam os cantos do vértice em grupos ao redor do leque e cada
+// grupo compartilha um vetor normal (índices de 32 bits limitam geometria a 1,4 bilhão de triângulos)
+void generateNormals(TriangleMesh * triangleMesh, double creaseAngle = CGC_PI, bool angleWeighted = true,
+    size_t threadCount = 0);
+// Gera vetores normais suaves por vértice da geometria de precisão simples
+void generateNormals(TriangleMeshf * triangleMesh, double creaseAngle = CGC_PI, bool angleWeighted = true,
+    size_t threadCount = 0);
+// Gera vetores tangentes e bitangentes ortonormais ao vetor normal pela variação das coordenadas de textura
+// (um par por combinação distinta de vértice, vetor normal e coordenadas de textura, com soma ponderada pelo
+// ângulo do canto); retorna falso se geometria não tem vetores normais ou coordenadas de textura
+bool generateTangents(TriangleMesh * triangleMesh, size_t threadCount = 0);
+// Gera vetores tangentes e bitangentes da geometria de precisão simples
+bool generateTangents(TriangleMeshf * triangleMesh, size_t threadCount = 0);
+
+#endif
@@ -0,0 +1,134 @@
+// File:    MeshIntersector.h
+// Author:  Danilo Peixoto
+// Date:    17/10/2026
+
+// Evita redefinição de símbolos do arquivo de cabeçalho (caso já tenha sido incluído)
+#ifndef CGC_MESH_INTERSECTOR_H
+#define CGC_MESH_INTERSECTOR_H
+
+#include <Vector.h>
+#include <BoundingVolumeHierarchy.h>
+
+#include <vector>
+#include <limits>
+#include <cstdint>
+
+// Declaração de tipo incompleto no cabeçalho evita dependência cíclica de arquivos
+class TriangleMesh;
+class TriangleMeshf;
+
+// Raio em precisão simples (pontos "origem + t * direção" com t em [minimumDistance, maximumDistance])
+class Ray {
+public:
+    Vector3f origin; // Origem
+    Vector3f direction; // Direção (não precisa ser unitária; distâncias são medidas em múltiplos dela)
+    float minimumDistance; // Menor distância válida
+    float maximumDistance; // Maior distância válida
+
+    // Construtor padrão (raio nulo de alcance infinito)
+    Ray();
+    // Construtor para valores iniciais
+    Ray(const Vector3f & origin, const Vector3f & direction, float minimumDistance = 0,
+        float maximumDistance = std::numeric_limits<float>::infinity());
+    // Destrutor padrão
+    ~Ray();
+};
+
+// Interseção mais próxima de um raio
+class RayHit {
+public:
+    size_t triangle; // Índice do triângulo ("RayHit::none" se não houve interseção)
+    float u, v; // Coordenadas baricêntricas dos vértices 1 e 2 (vértice 0 tem peso "1 - u - v")
+    float distance; // Distância ao longo do raio
+
+    // Índice de triângulo que indica ausência de interseção
+    static const size_t none;
+
+    // Construtor padrão (sem interseção)
+    RayHit();
+    // Destrutor padrão
+    ~RayHit();
+
+    // Verifica se houve interseção
+    bool isHit() const;
+};
+
+// Ponto mais próximo da geometria em relação a um ponto de consulta
+class PointHit {
+public:
+    size_t triangle; // Índice do triângulo ("PointHit::none" se não há triângulo no raio de busca)
+    float u, v; // Coordenadas baricêntricas dos vértices 1 e 2 (vértice 0 tem peso "1 - u - v")
+    float distance; // Distância ao ponto de consulta
+    Vector3f point; // Ponto mais próximo na superfície
+
+    // Índice de triângulo que indica ausência de resultado
+    static const size_t none;
+
+    // Construtor padrão (sem resultado)
+    PointHit();
+    // Destrutor padrão
+    ~PointHit();
+
+    // Verifica se há resultado
+    bool isHit() const;
+};
+
+// Quatro triângulos de uma folha com componentes separados para teste simultâneo
+class TrianglePacket {
+public:
+    float vertex[3][4]; // Primeiro vértice por componente
+    float edge1[3][4]; // Aresta do primeiro ao segundo vértice por componente
+    float edge2[3][4]; // Aresta do primeiro ao terceiro vértice por componente
+    uint32_t triangles[4]; // Índices dos triângulos (posições vazias têm arestas nulas)
+};
+
+// Consultas de raios e de proximidade sobre uma geometria (hierarquia com folhas de até quatro triângulos)
+class MeshIntersector {
+private:
+    std::vector<BoundingVolumeNode> nodes; // Nós da hierarquia (folhas apontam para grupos de triângulos)
+    std::vector<TrianglePacket> packets; // Grupos de triângulos na ordem das folhas
+    size_t depth; // Profundidade máxima da hierarquia (limite da pilha de travessia)
+
+public:
+    // Construtor padrão (sem geometria)
+    MeshIntersector();
+    // Construtor para geometria de precisão dupla (triângulos convertidos para precisão simples)
+    MeshIntersector(const TriangleMesh & triangleMesh, size_t threadCount = 0);
+    // Construtor para geometria de precisão simples
+    MeshIntersector(const TriangleMeshf & triangleMesh, size_t threadCount = 0);
+    // Destrutor padrão
+    ~MeshIntersector();
+
+    // Retorna número de nós da hierarquia
+    size_t getNodeCount() const;
+    // Retorna tamanho da memória ocupada em bytes
+    size_t getMemorySize() const;
+    // Verifica se não há geometria
+    bool isEmpty() const;
+
+    // Calcula interseção mais próxima do raio (retorna falso se não houve interseção)
+    bool intersect(const Ray & ray, RayHit & hit) const;
+    // Verifica se há qualquer interseção ao longo do raio
+    bool occluded(const Ray & ray) const;
+    // Calcula interseções mais próximas de uma lista de raios em paralelo (raios consecutivos são
+    // testados em grupos de quatro; retorna número de interseções)
+    size_t intersect(const Ray * rays, RayHit * hits, size_t count, size_t threadCount = 0) const;
+    // Verifica oclusão de uma lista de raios em paralelo (retorna número de raios obstruídos)
+    size_t occluded(const Ray * rays, bool * results, size_t count, size_t threadCount = 0) const;
+    // Calcula ponto mais próximo da geometria a menos de "maximumDistance" do ponto de consulta (retorna
+    // falso se não há triângulo no raio de busca)
+    bool getClosestPoint(const Vector3f & point, PointHit & hit,
+        float maximumDistance = std::numeric_limits<float>::infinity()) const;
+    // Calcula pontos mais próximos de uma lista de pontos em paralelo (retorna número de resultados)
+    size_t getClosestPoints(const Vector3f * points, PointHit * hits, size_t count,
+        float maximumDistance = std::numeric_limits<float>::infinity(), size_t threadCount = 0) const;
+
+    // Cria estrutura para geometria de precisão dupla
+    MeshIntersector & create(const TriangleMesh & triangleMesh, size_t threadCount = 0);
+    // Cria estrutura para geometria de precisão simples
+    MeshIntersector & create(const TriangleMeshf & triangleMesh, size_t threadCount = 0);
+    // Remove geometria
+    MeshIntersector & clear();
+};
+
+#endif
@@ -0,0 +1,73 @@
+// File:    MeshOptimizer.h
+// Author:  Danilo Peixoto
+// Date:    17/10/2026
+
+// Evita redefinição de símbolos do arquivo de cabeçalho (caso já tenha sido incluído)
+#ifndef CGC_MESH_OPTIMIZER_H
+#define CGC_MESH_OPTIMIZER_H
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+// Declaração de tipo incompleto no cabeçalho evita dependência cíclica de arquivos
+class IndexBuffer;
+class TriangleMesh;
+class TriangleMeshf;
+class VertexBuffer;
+
+// Retorna ordem de triângulos que favorece o reaproveitamento de vértices transformados em uma memória
+// FIFO de "cacheSize" vértices (algoritmo Tipsify de Sander, Nehab e Barczak, tempo linear)
+std::vector<size_t> getVertexCacheOrder(const IndexBuffer & indices, size_t vertexCount,
+    size_t cacheSize = 16);
+// Reordena triângulos da geometria pela ordem de reaproveitamento dos índices de vértices
+void optimizeVertexCache(TriangleMesh * triangleMesh, size_t cacheSize = 16);
+// Reordena triângulos da geometria de precisão simples pela ordem de reaproveitamento dos índices de vértices
+void optimizeVertexCache(TriangleMeshf * triangleMesh, size_t cacheSize = 16);
+// Reordena triângulos da lista de vértices intercalados pela ordem de reaproveitamento dos índices
+void optimizeVertexCache(VertexBuffer * vertexBuffer, size_t cacheSize = 16);
+// Retorna nova posição de cada um dos "count" elementos na ordem do primeiro uso pelos índices
+// (elementos não referenciados são mantidos ao final na ordem original)
+std::vector<size_t> getVertexFetchRemap(const IndexBuffer & indices, size_t count);
+// Renumera vértices, vetores normais e coordenadas de textura na ordem do primeiro uso pelos triângulos
+void optimizeVertexFetch(TriangleMesh * triangleMesh);
+// Renumera atributos da geometria de precisão simples na ordem do primeiro uso pelos triângulos
+void optimizeVertexFetch(TriangleMeshf * triangleMesh);
+// Renumera vértices intercalados na ordem do primeiro uso pelos triângulos
+void optimizeVertexFetch(VertexBuffer * vertexBuffer);
+// Retorna códigos de Morton de 30 ou 63 bits dos centróides dos triângulos (posições normalizadas pela
+// caixa envolvente dos vértices; "bits" acima de 30 produz códigos de 63 bits)
+std::vector<uint64_t> getMortonCodes(const TriangleMesh & triangleMesh, size_t bits = 30,
+    size_t threadCount = 0);
+// Retorna códigos de Morton dos centróides dos triângulos da geometria de precisão simples
+std::vector<uint64_t> getMortonCodes(const TriangleMeshf & triangleMesh, size_t bits = 30,
+    size_t threadCount = 0);
+// Retorna ordem estável dos códigos pelos "bits" menos significativos (ordenação radix paralela)
+std::vector<size_t> sortMortonCodes(const std::vector<uint64_t> & codes, size_t bits = 30,
+    size_t threadCount = 0);
+// Reordena triângulos pela curva de Morton dos centróides (e atributos na ordem do primeiro uso; "bits"
+// acima de 30 utiliza códigos de 63 bits)
+void optimizeSpatialOrder(TriangleMesh * triangleMesh, bool reorderAttributes = false, size_t bits = 30,
+    size_t threadCount = 0);
+// Reordena triângulos da geometria de precisão simples pela curva de Morton dos centróides
+void optimizeSpatialOrder(TriangleMeshf * triangleMesh, bool reorderAttributes = false, size_t bits = 30,
+    size_t threadCount = 0);
+// Retorna nova posição de cada vértice após a união de vértices a menos de "epsilon" (grupos são
+// transitivos e numerados pelo menor vértice; tolerância nula une apenas posições idênticas)
+std::vector<size_t> getVertexWeldRemap(const TriangleMesh & triangleMesh, double epsilon = 0,
+    size_t threadCount = 0);
+// Retorna nova posição de cada vértice da geometria de precisão simples após a união de vértices
+std::vector<size_t> getVertexWeldRemap(const TriangleMeshf & triangleMesh, double epsilon = 0,
+    size_t threadCount = 0);
+// Une vértices a menos de "epsilon" por grade espacial em paralelo e remove triângulos degenerados
+// resultantes (retorna número de vértices removidos; tabelas usam índices de 32 bits até 2^31 vértices e de
+// 64 bits acima disso)
+size_t weldVertices(TriangleMesh * triangleMesh, double epsilon = 0, size_t threadCount = 0);
+// Une vértices da geometria de precisão simples e remove triângulos degenerados resultantes
+size_t weldVertices(TriangleMeshf * triangleMesh, double epsilon = 0, size_t threadCount = 0);
+// Retorna número médio de vértices transformados por triângulo (ACMR) em uma memória FIFO de "cacheSize" vértices
+double getAverageCacheMissRatio(const IndexBuffer & indices, size_t cacheSize = 32);
+// Retorna número médio de transformações por vértice utilizado (ATVR) em uma memória FIFO de "cacheSize" vértices
+double getAverageTransformRatio(const IndexBuffer & indices, size_t cacheSize = 32);
+
+#endif
@@ -0,0 +1,123 @@
+// File:    MeshTopology.h
+// Author:  Danilo Peixoto
+// Date:    17/10/2026
+
+// Evita redefinição de símbolos do arquivo de cabeçalho (caso já tenha sido incluído)
+#ifndef CGC_MESH_TOPOLOGY_H
+#define CGC_MESH_TOPOLOGY_H
+
+#include <IndexBuffer.h>
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Declaração de tipo incompleto no cabeçalho evita dependência cíclica de arquivos
+class TriangleMesh;
+class TriangleMeshf;
+
+// Adjacência de semiarestas implícitas em listas contíguas (semiaresta "3 * t + k" vai do vértice "k" ao
+// vértice "(k + 1) % 3" do triângulo "t"; índices de 32 bits limitam geometria a 1,4 bilhão de triângulos)
+class MeshTopology {
+private:
+    std::vector<uint32_t> origins; // Vértice de origem de cada semiaresta
+    std::vector<uint32_t> twins; // Semiaresta oposta de cada semiaresta ("none" na borda)
+    std::vector<uint32_t> vertexEdges; // Semiaresta que parte de cada vértice (preferência pela borda)
+    size_t boundaryEdgeCount; // Número de semiarestas sem oposta
+    size_t nonManifoldEdgeCount; // Número de arestas compartilhadas por mais de dois triângulos
+
+public:
+    // Índice que indica ausência de semiaresta
+    static const size_t none;
+
+    // Construtor padrão (topologia vazia)
+    MeshTopology();
+    // Construtor para lista de índices de triângulos
+    MeshTopology(const IndexBuffer & vertexIndices, size_t vertexCount);
+    // Construtor para geometria de precisão dupla
+    MeshTopology(const TriangleMesh & triangleMesh);
+    // Construtor para geometria de precisão simples
+    MeshTopology(const TriangleMeshf & triangleMesh);
+    // Destrutor padrão
+    ~MeshTopology();
+
+    // Retorna número de semiarestas (três por triângulo)
+    size_t getHalfEdgeCount() const;
+    // Retorna número de triângulos
+    size_t getTriangleCount() const;
+    // Retorna número de vértices
+    size_t getVertexCount() const;
+    // Retorna número de semiarestas de borda
+    size_t getBoundaryEdgeCount() const;
+    // Retorna número de arestas não manifold (mantidas como borda)
+    size_t getNonManifoldEdgeCount() const;
+    // Retorna tamanho da memória ocupada em bytes
+    size_t getMemorySize() const;
+    // Verifica se topologia está vazia
+    bool isEmpty() const;
+
+    // Retorna semiaresta oposta ("none" na borda)
+    size_t getTwin(size_t h) const;
+    // Retorna próxima semiaresta do mesmo triângulo
+    size_t getNext(size_t h) const;
+    // Retorna semiaresta anterior do mesmo triângulo
+    size_t getPrevious(size_t h) const;
+    // Retorna triângulo da semiaresta
+    size_t getTriangle(size_t h) const;
+    // Retorna vértice de origem da semiaresta
+    size_t getOrigin(size_t h) const;
+    // Retorna vértice de destino da semiaresta
+    size_t getTarget(size_t h) const;
+    // Retorna semiaresta que parte do vértice ("none" para vértice isolado; semiaresta de borda se houver)
+    size_t getVertexEdge(size_t v) const;
+    // Verifica se semiaresta está na borda
+    bool isBoundaryEdge(size_t h) const;
+    // Verifica se vértice está na borda
+    bool isBoundaryVertex(size_t v) const;
+
+    // Retorna triângulos vizinhos pelas arestas do triângulo ("none" na borda)
+    void getTriangleNeighbors(size_t t, size_t & t0, size_t & t1, size_t & t2) const;
+    // Retorna semiarestas que partem do vértice em ordem de rotação (um único leque em vértice não
+    // manifold)
+    void getVertexEdges(size_t v, std::vector<size_t> & edges) const;
+    // Retorna triângulos ao redor do vértice em ordem de rotação
+    void getVertexTriangles(size_t v, std::vector<size_t> & triangles) const;
+    // Retorna vértices vizinhos em ordem de rotação
+    void getVertexNeighbors(size_t v, std::vector<size_t> & neighbors) const;
+    // Retorna laços de borda como listas de vértices
+    void getBoundaryLoops(std::vector<std::vector<size_t>> & loops) const;
+
+    // Cria topologia para lista de índices de triângulos em tempo linear no número de semiarestas e vértices
+    MeshTopology & create(const IndexBuffer & vertexIndices, size_t vertexCount);
+    // Cria topologia para geometria de precisão dupla
+    MeshTopology & create(const TriangleMesh & triangleMesh);
+    // Cria topologia para geometria de precisão simples
+    MeshTopology & create(const TriangleMeshf & triangleMesh);
+    // Remove topologia
+    MeshTopology & clear();
+};
+
+// Navegação é definida no cabeçalho para ser expandida em laços sobre semiarestas
+inline size_t MeshTopology::getTwin(size_t h) const {
+    return twins[h] == UINT32_MAX ? none : twins[h];
+}
+inline size_t MeshTopology::getNext(size_t h) const {
+    return h % 3 == 2 ? h - 2 : h + 1;
+}
+inline size_t MeshTopology::getPrevious(size_t h) const {
+    return h % 3 == 0 ? h + 2 : h - 1;
+}
+inline size_t MeshTopology::getTriangle(size_t h) const {
+    return h / 3;
+}
+inline size_t MeshTopology::getOrigin(size_t h) const {
+    return origins[h];
+}
+inline size_t MeshTopology::getTarget(size_t h) const {
+    return origins[getNext(h)];
+}
+inline bool MeshTopology::isBoundaryEdge(size_t h) const {
+    return twins[h] == UINT32_MAX;
+}
+
+#endif
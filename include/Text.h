@@ -0,0 +1,49 @@
+// File:    Text.h
+// Author:  Danilo Peixoto
+// Date:    16/10/2026
+
+// Evita redefinição de símbolos do arquivo de cabeçalho (caso já tenha sido incluído)
+#ifndef CGC_TEXT_H
+#define CGC_TEXT_H
+
+#include <cstddef>
+
+// Tamanho de memória suficiente para formatar qualquer número real com até 17 casas decimais
+#define CGC_REAL_TEXT_SIZE 352
+
+// Verifica se caractere é espaço em branco dentro de uma linha
+inline bool isSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+// Verifica se caractere é dígito decimal
+inline bool isDigit(char c) {
+    return (unsigned char)(c - '0') < 10;
+}
+// Avança sobre espaços em branco sem ultrapassar o fim da linha
+inline const char * skipSpaces(const char * begin, const char * end) {
+    while (begin != end && isSpace(*begin))
+        begin++;
+
+    return begin;
+}
+// Avança até o início da próxima linha
+inline const char * skipLine(const char * begin, const char * end) {
+    while (begin != end && *begin != '\n')
+        begin++;
+
+    return begin != end ? begin + 1 : end;
+}
+
+// Converte texto em número real com arredondamento correto (retorna posição após o número)
+const char * parseReal(const char * begin, const char * end, double & value);
+// Converte texto em número inteiro sem sinal (retorna posição após o número)
+const char * parseInteger(const char * begin, const char * end, size_t & value);
+// Formata número real com "precision" casas decimais ou, se negativo, com a menor representação
+// que preserva o valor na leitura (retorna posição após o texto escrito)
+char * formatReal(char * buffer, double value, int precision);
+// Formata número real de precisão simples (representação mínima considera a precisão simples)
+char * formatReal(char * buffer, float value, int precision);
+// Formata número inteiro sem sinal (retorna posição após o texto escrito)
+char * formatInteger(char * buffer, size_t value);
+
+#endif
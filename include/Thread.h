@@ -0,0 +1,58 @@
+// File:    Thread.h
+// Author:  Danilo Peixoto
+// Date:    16/10/2026
+
+// Evita redefinição de símbolos do arquivo de cabeçalho (caso já tenha sido incluído)
+#ifndef CGC_THREAD_H
+#define CGC_THREAD_H
+
+#include <vector>
+#include <deque>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+// Conjunto de threads persistentes para execução paralela de tarefas
+class ThreadPool {
+private:
+    size_t threadCount; // Número de threads de trabalho
+    bool running; // Estado de execução das threads
+    std::vector<std::thread> threads; // Lista de threads de trabalho
+    std::deque<std::function<void()>> tasks; // Fila de tarefas pendentes
+    std::mutex mutex; // Exclusão mútua da fila de tarefas
+    std::condition_variable condition; // Sinalização de novas tarefas
+
+    // Rotina executada por cada thread de trabalho
+    void work();
+    // Inicia threads de trabalho (na primeira utilização)
+    ThreadPool & start();
+
+public:
+    // Construtor para número de threads (zero utiliza todas as threads do processador)
+    ThreadPool(size_t threadCount = 0);
+    // Destrutor padrão (aguarda término das threads)
+    ~ThreadPool();
+
+    // Impede cópia das threads
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool & operator =(const ThreadPool &) = delete;
+
+    // Retorna número de threads de trabalho
+    size_t getThreadCount() const;
+
+    // Executa função para cada índice em [0, count) e aguarda o término (thread atual também participa)
+    ThreadPool & run(size_t count, const std::function<void(size_t)> & function,
+        size_t threadCount = 0);
+    // Executa função sobre blocos do intervalo [begin, end) com tamanho mínimo "grainSize"
+    ThreadPool & run(size_t begin, size_t end, size_t grainSize,
+        const std::function<void(size_t, size_t)> & function, size_t threadCount = 0);
+};
+
+// Instância padrão do conjunto de threads
+extern ThreadPool threadPool;
+
+// Retorna número de threads do processador
+size_t getHardwareThreadCount();
+
+#endif
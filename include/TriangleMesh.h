@@ -1,129 +1,296 @@
-// File:    TriangleMesh.h
-// Author:  Danilo Peixoto
-// Date:    06/08/2018
-
-// Evita redefinio de smbolos do arquivo de cabealho (caso j tenha sido includo)
-#ifndef CGC_TRIANGLE_MESH_H
-#define CGC_TRIANGLE_MESH_H
-
-#include <vector>
-#include <ostream>
-
-// Declarao de tipo incompleto no cabealho evita dependncia cclica de arquivos
-class Vector2;
-class Vector3;
-class Matrix4;
-
-// Geometria representada por tringulos (vrtices em ordem anti-horria)
-class TriangleMesh {
-private:
-    std::vector<Vector3> vertices; // Lista de vrtices
-    std::vector<Vector3> normals; // Lista de vetores normais
-    std::vector<Vector2> textureCoordinates; // Lista de coordenadas de textura
-    std::vector<size_t> vertexIndices; // Lista de ndices de vrtices por tringulo
-    std::vector<size_t> normalIndices; // Lista de ndices de vetores normais por tringulo
-    std::vector<size_t> textureIndices; // Lista de ndices de coordenadas de textura por tringulo
-
-public:
-    // Construtor padro (geometria nula)
-    TriangleMesh();
-    // Construtor cpia
-    TriangleMesh(const TriangleMesh & triangleMesh);
-    // Construtor para alocao de parmetros
-    TriangleMesh(size_t vertexCount, size_t triangleCount,
-        size_t normalCount = 0, size_t textureCoordinateCount = 0);
-    // Construtor simples para parmetros iniciais
-    TriangleMesh(
-        const std::vector<Vector3> & vertices,
-        const std::vector<size_t> & vertexIndices);
-    // Construtor completo para parmetros iniciais
-    TriangleMesh(
-        const std::vector<Vector3> & vertices,
-        const std::vector<Vector3> & normals,
-        const std::vector<Vector2> & textureCoordinates,
-        const std::vector<size_t> & vertexIndices,
-        const std::vector<size_t> & normalIndices,
-        const std::vector<size_t> & textureIndices);
-    // Destrutor padro
-    ~TriangleMesh();
-
-    // Sobrecarga da operao "geometriaA == geometriaB"
-    bool operator ==(const TriangleMesh & rhs) const;
-    // Sobrecarga da operao "geometriaA != geometriaB"
-    bool operator !=(const TriangleMesh & rhs) const;
-    // Sobrecarga da operao "sada << geometria" (imprimir informaes na sada de dados)
-    friend std::ostream & operator <<(std::ostream & lhs, const TriangleMesh & rhs);
-
-    // Configura um vrtice pelo ndice
-    TriangleMesh & setVertex(size_t i, const Vector3 & vertex);
-    // Configura vetor normal pelo ndice
-    TriangleMesh & setNormal(size_t i, const Vector3 & normal);
-    // Configura coordenadas de textura pelo ndice
-    TriangleMesh & setTextureCoordinates(size_t i, const Vector2 & textureCoordinates);
-    // Configura os ndices dos vrtices de um tringulo
-    TriangleMesh & setVertexIndices(size_t i, size_t v0, size_t v1, size_t v2);
-    // Configura os ndices dos vetores normais de um tringulo
-    TriangleMesh & setNormalIndices(size_t i, size_t v0, size_t v1, size_t v2);
-    // Configura os ndices das coordenadas de textura de um tringulo
-    TriangleMesh & setTextureIndices(size_t i, size_t v0, size_t v1, size_t v2);
-    // Retorna lista de vrtices
-    const std::vector<Vector3> & getVertices() const;
-    // Retorna lista de vetores normais
-    const std::vector<Vector3> & getNormals() const;
-    // Retorna lista de coordenadas de textura
-    const std::vector<Vector2> & getTextureCoordinates() const;
-    // Retorna lista de ndices de vrtices por tringulo
-    const std::vector<size_t> & getVertexIndices() const;
-    // Retorna lista de ndices de vetores normais por tringulo
-    const std::vector<size_t> & getNormalIndices() const;
-    // Retorna lista de ndices de coordenadas de textura por tringulo
-    const std::vector<size_t> & getTextureIndices() const;
-    // Retorna vrtice pelo ndice
-    const Vector3 & getVertex(size_t i) const;
-    // Retorna vetor normal pelo ndice
-    const Vector3 & getNormal(size_t i) const;
-    // Retorna coordenadas de textura pelo ndice
-    const Vector2 & getTextureCoordinates(size_t i) const;
-    // Retorna ndices dos vrtices de um tringulo
-    void getVertexIndices(size_t i, size_t & v0, size_t & v1, size_t & v2) const;
-    // Retorna ndices dos vetores normais de um tringulo
-    void getNormalIndices(size_t i, size_t & v0, size_t & v1, size_t & v2) const;
-    // Retorna ndices das coordenadas de textura de um tringulo
-    void getTextureIndices(size_t i, size_t & v0, size_t & v1, size_t & v2) const;
-    // Retorna nmero de vrtices
-    size_t getVertexCount() const;
-    // Retorna nmero de vetores normais
-    size_t getNormalCount() const;
-    // Retorna nmero de coordenadas de textura
-    size_t getTextureCoordinateCount() const;
-    // Retorna nmero de tringulos
-    size_t getTriangleCount() const;
-    // Verifica se geometria tem vetores normais
-    bool hasNormals() const;
-    // Verifica se geometria tem coordenadas de textura
-    bool hasTextureCoordinates() const;
-
-    // Cria geometria por cpia
-    TriangleMesh & create(const TriangleMesh & triangleMesh);
-    // Cria geometria alocando memria para atributos
-    TriangleMesh & create(
-        size_t vertexCount, size_t triangleCount,
-        size_t normalCount = 0, size_t textureCoordinateCount = 0);
-    // Cria geometria com atributos bsicos
-    TriangleMesh & create(
-        const std::vector<Vector3> & vertices,
-        const std::vector<size_t> & vertexIndices);
-    // Cria geometria com todos atributos
-    TriangleMesh & create(
-        const std::vector<Vector3> & vertices,
-        const std::vector<Vector3> & normals,
-        const std::vector<Vector2> & textureCoordinates,
-        const std::vector<size_t> & vertexIndices,
-        const std::vector<size_t> & normalIndices,
-        const std::vector<size_t> & textureIndices);
-
-    // Transforma geometria utilizando matriz 4x4
-    TriangleMesh & transform(const Matrix4 & transformation);
-};
-
+// File:    TriangleMesh.h
+// Author:  Danilo Peixoto
+// Date:    06/08/2018
+
+// Evita redefinição de símbolos do arquivo de cabeçalho (caso já tenha sido incluído)
+#ifndef CGC_TRIANGLE_MESH_H
+#define CGC_TRIANGLE_MESH_H
+
+#include <IndexBuffer.h>
+#include <Bounds.h>
+
+#include <vector>
+#include <ostream>
+#include <atomic>
+#include <mutex>
+
+// Declaração de tipo incompleto no cabeçalho evita dependência cíclica de arquivos
+class Vector2;
+class Vector3;
+class Vector2f;
+class Vector3f;
+class Matrix4;
+class TriangleMesh;
+class TriangleMeshf;
+
+// Implementação comum das geometrias de precisão dupla e simples (operações encadeadas retornam a classe derivada
+// "Mesh"; atributos são do tipo "Vector3Type" e "Vector2Type" com componentes do tipo "Real")
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+class TriangleMeshBase {
+private:
+    std::vector<Vector3Type> vertices; // Lista de vértices
+    std::vector<Vector3Type> normals; // Lista de vetores normais
+    std::vector<Vector2Type> textureCoordinates; // Lista de coordenadas de textura
+    IndexBuffer vertexIndices; // Lista de índices de vértices por triângulo
+    IndexBuffer normalIndices; // Lista de índices de vetores normais por triângulo
+    IndexBuffer textureIndices; // Lista de índices de coordenadas de textura por triângulo
+    std::vector<Vector3Type> tangents; // Lista de vetores tangentes
+    std::vector<Vector3Type> bitangents; // Lista de vetores bitangentes (mesmos índices dos vetores tangentes)
+    IndexBuffer tangentIndices; // Lista de índices de vetores tangentes por triângulo
+    mutable BoundingBox boundingBox; // Caixa envolvente dos vértices (calculada na primeira consulta)
+    mutable BoundingSphere boundingSphere; // Esfera envolvente dos vértices (calculada com a caixa)
+    mutable std::atomic<bool> boundsValid; // Indica se volumes envolventes correspondem aos vértices
+    mutable std::mutex boundsMutex; // Serializa o cálculo dos volumes envolventes entre consultas simultâneas
+
+    // Calcula volumes envolventes se os vértices foram alterados desde o último cálculo
+    void updateBounds() const;
+    // Copia volumes envolventes válidos de outra geometria (invalida os atuais caso contrário)
+    void copyBounds(const TriangleMeshBase & triangleMesh);
+
+protected:
+    // Converte atributos de geometria de outra precisão (valores arredondados na conversão para precisão simples)
+    template<typename OtherMesh>
+    Mesh & convert(const OtherMesh & triangleMesh);
+
+public:
+    // Construtor padrão (geometria nula)
+    TriangleMeshBase();
+    // Construtor para alocação de parâmetros
+    TriangleMeshBase(size_t vertexCount, size_t triangleCount,
+        size_t normalCount = 0, size_t textureCoordinateCount = 0);
+    // Construtor simples para parâmetros iniciais
+    TriangleMeshBase(
+        const std::vector<Vector3Type> & vertices,
+        const std::vector<size_t> & vertexIndices);
+    // Construtor simples que assume a memória dos parâmetros iniciais (sem cópia)
+    TriangleMeshBase(
+        std::vector<Vector3Type> && vertices,
+        std::vector<size_t> && vertexIndices);
+    // Construtor completo para parâmetros iniciais
+    TriangleMeshBase(
+        const std::vector<Vector3Type> & vertices,
+        const std::vector<Vector3Type> & normals,
+        const std::vector<Vector2Type> & textureCoordinates,
+        const std::vector<size_t> & vertexIndices,
+        const std::vector<size_t> & normalIndices,
+        const std::vector<size_t> & textureIndices);
+    // Construtor completo que assume a memória dos parâmetros iniciais (sem cópia)
+    TriangleMeshBase(
+        std::vector<Vector3Type> && vertices,
+        std::vector<Vector3Type> && normals,
+        std::vector<Vector2Type> && textureCoordinates,
+        std::vector<size_t> && vertexIndices,
+        std::vector<size_t> && normalIndices,
+        std::vector<size_t> && textureIndices);
+    // Construtor completo que assume a memória de listas de índices compactas (sem cópia)
+    TriangleMeshBase(
+        std::vector<Vector3Type> && vertices,
+        std::vector<Vector3Type> && normals,
+        std::vector<Vector2Type> && textureCoordinates,
+        IndexBuffer && vertexIndices,
+        IndexBuffer && normalIndices,
+        IndexBuffer && textureIndices);
+    // Destrutor padrão
+    ~TriangleMeshBase();
+
+    // Sobrecarga da operação "geometriaA == geometriaB"
+    bool operator ==(const Mesh & rhs) const;
+    // Sobrecarga da operação "geometriaA != geometriaB"
+    bool operator !=(const Mesh & rhs) const;
+
+    // Configura um vértice pelo índice
+    Mesh & setVertex(size_t i, const Vector3Type & vertex);
+    // Configura vetor normal pelo índice
+    Mesh & setNormal(size_t i, const Vector3Type & normal);
+    // Configura coordenadas de textura pelo índice
+    Mesh & setTextureCoordinates(size_t i, const Vector2Type & textureCoordinates);
+    // Configura os índices dos vértices de um triângulo
+    Mesh & setVertexIndices(size_t i, size_t v0, size_t v1, size_t v2);
+    // Configura os índices dos vetores normais de um triângulo
+    Mesh & setNormalIndices(size_t i, size_t v0, size_t v1, size_t v2);
+    // Configura os índices das coordenadas de textura de um triângulo
+    Mesh & setTextureIndices(size_t i, size_t v0, size_t v1, size_t v2);
+    // Configura largura em bytes de todas listas de índices (nunca menor que a necessária)
+    Mesh & setIndexWidth(size_t width);
+    // Substitui vetores normais e seus índices assumindo a memória dos parâmetros (sem cópia; remove tangentes)
+    Mesh & setNormals(std::vector<Vector3Type> && normals, IndexBuffer && normalIndices);
+    // Substitui vetores tangentes, bitangentes e seus índices assumindo a memória dos parâmetros (sem cópia)
+    Mesh & setTangents(std::vector<Vector3Type> && tangents, std::vector<Vector3Type> && bitangents,
+        IndexBuffer && tangentIndices);
+    // Retorna lista de vértices
+    const std::vector<Vector3Type> & getVertices() const;
+    // Retorna lista de vetores normais
+    const std::vector<Vector3Type> & getNormals() const;
+    // Retorna lista de coordenadas de textura
+    const std::vector<Vector2Type> & getTextureCoordinates() const;
+    // Retorna lista de índices de vértices por triângulo
+    const IndexBuffer & getVertexIndices() const;
+    // Retorna lista de índices de vetores normais por triângulo
+    const IndexBuffer & getNormalIndices() const;
+    // Retorna lista de índices de coordenadas de textura por triângulo
+    const IndexBuffer & getTextureIndices() const;
+    // Retorna lista de vetores tangentes
+    const std::vector<Vector3Type> & getTangents() const;
+    // Retorna lista de vetores bitangentes
+    const std::vector<Vector3Type> & getBitangents() const;
+    // Retorna lista de índices de vetores tangentes por triângulo
+    const IndexBuffer & getTangentIndices() const;
+    // Retorna vértice pelo índice
+    const Vector3Type & getVertex(size_t i) const;
+    // Retorna vetor normal pelo índice
+    const Vector3Type & getNormal(size_t i) const;
+    // Retorna coordenadas de textura pelo índice
+    const Vector2Type & getTextureCoordinates(size_t i) const;
+    // Retorna vetor tangente pelo índice
+    const Vector3Type & getTangent(size_t i) const;
+    // Retorna vetor bitangente pelo índice
+    const Vector3Type & getBitangent(size_t i) const;
+    // Retorna índices dos vértices de um triângulo
+    void getVertexIndices(size_t i, size_t & v0, size_t & v1, size_t & v2) const;
+    // Retorna índices dos vetores normais de um triângulo
+    void getNormalIndices(size_t i, size_t & v0, size_t & v1, size_t & v2) const;
+    // Retorna índices das coordenadas de textura de um triângulo
+    void getTextureIndices(size_t i, size_t & v0, size_t & v1, size_t & v2) const;
+    // Retorna índices dos vetores tangentes de um triângulo
+    void getTangentIndices(size_t i, size_t & v0, size_t & v1, size_t & v2) const;
+    // Retorna número de vértices
+    size_t getVertexCount() const;
+    // Retorna número de vetores normais
+    size_t getNormalCount() const;
+    // Retorna número de coordenadas de textura
+    size_t getTextureCoordinateCount() const;
+    // Retorna número de vetores tangentes
+    size_t getTangentCount() const;
+    // Retorna número de triângulos
+    size_t getTriangleCount() const;
+    // Verifica se geometria tem vetores normais
+    bool hasNormals() const;
+    // Verifica se geometria tem coordenadas de textura
+    bool hasTextureCoordinates() const;
+    // Verifica se geometria tem vetores tangentes
+    bool hasTangents() const;
+    // Retorna caixa envolvente dos vértices (calculada na primeira consulta e mantida até alterar os vértices)
+    const BoundingBox & getBoundingBox() const;
+    // Retorna esfera envolvente dos vértices (centrada na caixa envolvente)
+    const BoundingSphere & getBoundingSphere() const;
+
+    // Cria geometria por cópia
+    Mesh & create(const Mesh & triangleMesh);
+    // Cria geometria assumindo a memória de outra geometria (sem cópia)
+    Mesh & create(Mesh && triangleMesh);
+    // Cria geometria alocando memória para atributos
+    Mesh & create(
+        size_t vertexCount, size_t triangleCount,
+        size_t normalCount = 0, size_t textureCoordinateCount = 0);
+    // Cria geometria com atributos básicos
+    Mesh & create(
+        const std::vector<Vector3Type> & vertices,
+        const std::vector<size_t> & vertexIndices);
+    // Cria geometria com atributos básicos assumindo a memória dos parâmetros (sem cópia)
+    Mesh & create(
+        std::vector<Vector3Type> && vertices,
+        std::vector<size_t> && vertexIndices);
+    // Cria geometria com todos atributos
+    Mesh & create(
+        const std::vector<Vector3Type> & vertices,
+        const std::vector<Vector3Type> & normals,
+        const std::vector<Vector2Type> & textureCoordinates,
+        const std::vector<size_t> & vertexIndices,
+        const std::vector<size_t> & normalIndices,
+        const std::vector<size_t> & textureIndices);
+    // Cria geometria com todos atributos assumindo a memória dos parâmetros (sem cópia)
+    Mesh & create(
+        std::vector<Vector3Type> && vertices,
+        std::vector<Vector3Type> && normals,
+        std::vector<Vector2Type> && textureCoordinates,
+        std::vector<size_t> && vertexIndices,
+        std::vector<size_t> && normalIndices,
+        std::vector<size_t> && textureIndices);
+    // Cria geometria com todos atributos assumindo a memória de listas de índices compactas (sem cópia)
+    Mesh & create(
+        std::vector<Vector3Type> && vertices,
+        std::vector<Vector3Type> && normals,
+        std::vector<Vector2Type> && textureCoordinates,
+        IndexBuffer && vertexIndices,
+        IndexBuffer && normalIndices,
+        IndexBuffer && textureIndices);
+    // Devolve a memória dos atributos ao chamador (índices compactos são ampliados para "size_t" e vetores
+    // tangentes são removidos)
+    Mesh & release(
+        std::vector<Vector3Type> & vertices,
+        std::vector<Vector3Type> & normals,
+        std::vector<Vector2Type> & textureCoordinates,
+        std::vector<size_t> & vertexIndices,
+        std::vector<size_t> & normalIndices,
+        std::vector<size_t> & textureIndices);
+    // Remove vetores tangentes (também removidos ao criar geometria a partir de listas de atributos)
+    Mesh & clearTangents();
+
+    // Reordena triângulos em todas listas de índices (triângulo "i" passa a ser o triângulo "order[i]")
+    Mesh & reorderTriangles(const std::vector<size_t> & order);
+    // Reordena atributos e atualiza listas de índices (atributo "i" passa à posição "remap[i]";
+    // lista de posições vazia mantém a ordem do atributo)
+    Mesh & reorderAttributes(
+        const std::vector<size_t> & vertexRemap,
+        const std::vector<size_t> & normalRemap,
+        const std::vector<size_t> & textureRemap);
+    // Transforma geometria utilizando matriz 4x4 em blocos paralelos vetorizados (operações na precisão dos
+    // atributos; matriz afim atualiza volumes envolventes sem percorrer os vértices)
+    Mesh & transform(const Matrix4 & transformation, size_t threadCount = 0);
+};
+
+// Geometria representada por triângulos (vértices em ordem anti-horária)
+class TriangleMesh : public TriangleMeshBase<TriangleMesh, Vector3, Vector2, double> {
+public:
+    // Construtores para alocação e para listas de atributos
+    using TriangleMeshBase::TriangleMeshBase;
+    using TriangleMeshBase::create;
+
+    // Construtor padrão (geometria nula)
+    TriangleMesh();
+    // Construtor cópia
+    TriangleMesh(const TriangleMesh & triangleMesh);
+    // Construtor de movimentação (assume a memória da outra geometria)
+    TriangleMesh(TriangleMesh && triangleMesh);
+    // Construtor de conversão de geometria de precisão simples
+    explicit TriangleMesh(const TriangleMeshf & triangleMesh);
+
+    // Sobrecarga da operação "geometriaA = geometriaB" (cópia)
+    TriangleMesh & operator =(const TriangleMesh & rhs);
+    // Sobrecarga da operação "geometriaA = geometriaB" (movimentação)
+    TriangleMesh & operator =(TriangleMesh && rhs);
+    // Sobrecarga da operação "saída << geometria" (imprimir informações na saída de dados)
+    friend std::ostream & operator <<(std::ostream & lhs, const TriangleMesh & rhs);
+
+    // Cria geometria por conversão de geometria de precisão simples
+    TriangleMesh & create(const TriangleMeshf & triangleMesh);
+};
+
+// Geometria representada por triângulos com atributos de precisão simples (metade da memória de "TriangleMesh")
+class TriangleMeshf : public TriangleMeshBase<TriangleMeshf, Vector3f, Vector2f, float> {
+public:
+    // Construtores para alocação e para listas de atributos
+    using TriangleMeshBase::TriangleMeshBase;
+    using TriangleMeshBase::create;
+
+    // Construtor padrão (geometria nula)
+    TriangleMeshf();
+    // Construtor cópia
+    TriangleMeshf(const TriangleMeshf & triangleMesh);
+    // Construtor de movimentação (assume a memória da outra geometria)
+    TriangleMeshf(TriangleMeshf && triangleMesh);
+    // Construtor de conversão de geometria de precisão dupla (valores arredondados)
+    explicit TriangleMeshf(const TriangleMesh & triangleMesh);
+
+    // Sobrecarga da operação "geometriaA = geometriaB" (cópia)
+    TriangleMeshf & operator =(const TriangleMeshf & rhs);
+    // Sobrecarga da operação "geometriaA = geometriaB" (movimentação)
+    TriangleMeshf & operator =(TriangleMeshf && rhs);
+    // Sobrecarga da operação "saída << geometria" (imprimir informações na saída de dados)
+    friend std::ostream & operator <<(std::ostream & lhs, const TriangleMeshf & rhs);
+
+    // Cria geometria por conversão de geometria de precisão dupla (valores arredondados)
+    TriangleMeshf & create(const TriangleMesh & triangleMesh);
+};
+
 #endif
\ No newline at end of file
@@ -1,25 +1,62 @@
-// File:    Utility.h
-// Author:  Danilo Peixoto
-// Date:    15/08/2018
-
-// Evita redefinio de smbolos do arquivo de cabealho (caso j tenha sido includo)
-#ifndef CGC_UTILITY_H
-#define CGC_UTILITY_H
-
-#include <string>
-
-// Declarao de tipo incompleto no cabealho evita dependncia cclica de arquivos
-class TriangleMesh;
-class Viewport3D;
-
-// Instncia de "viewport" 3D padro
-extern Viewport3D viewport3D;
-
-// L objeto geomtrico triangulado de um arquivo Wavefront OBJ
-TriangleMesh * readObject(const std::string & filename);
-// Escreve objeto geomtrico triangulado para um arquivo Wavefront OBJ
-bool writeObject(const std::string & filename, const TriangleMesh * triangleMesh);
-// Exibe objeto geomtrico em uma "viewport" 3D
-void showObject(const TriangleMesh * triangleMesh);
-
-#endif
\ No newline at end of file
+// File:    Utility.h
+// Author:  Danilo Peixoto
+// Date:    15/08/2018
+
+// Evita redefinição de símbolos do arquivo de cabeçalho (caso já tenha sido incluído)
+#ifndef CGC_UTILITY_H
+#define CGC_UTILITY_H
+
+#include <string>
+
+// Declaração de tipo incompleto no cabeçalho evita dependência cíclica de arquivos
+class Vector2;
+class Vector3;
+class TriangleMesh;
+class TriangleMeshf;
+class Viewport3D;
+
+// Receptor de registros de arquivo Wavefront OBJ lidos em fluxo (geometria não é armazenada)
+class ObjectVisitor {
+public:
+    // Destrutor padrão
+    virtual ~ObjectVisitor();
+
+    // Recebe vértice
+    virtual void visitVertex(const Vector3 & vertex);
+    // Recebe coordenadas de textura
+    virtual void visitTextureCoordinates(const Vector2 & textureCoordinates);
+    // Recebe vetor normal
+    virtual void visitNormal(const Vector3 & normal);
+    // Recebe índices de um triângulo a partir de zero (listas de índices ausentes são nulas)
+    virtual void visitTriangle(const size_t * vertexIndices,
+        const size_t * textureIndices, const size_t * normalIndices);
+};
+
+// Instância de "viewport" 3D padrão
+extern Viewport3D viewport3D;
+
+// Lê objeto geométrico triangulado de um arquivo Wavefront OBJ (trechos do arquivo são lidos em paralelo
+// por até "threadCount" threads, zero utiliza todas as threads do processador)
+TriangleMesh * readObject(const std::string & filename, size_t threadCount = 0);
+// Lê objeto geométrico triangulado de um arquivo Wavefront OBJ com atributos de precisão simples
+TriangleMeshf * readObjectf(const std::string & filename, size_t threadCount = 0);
+// Lê arquivo Wavefront OBJ em blocos repassando registros ao receptor com memória constante (falso se
+// arquivo não puder ser aberto ou a leitura falhar)
+bool readObject(const std::string & filename, ObjectVisitor & visitor);
+// Escreve objeto geométrico triangulado para um arquivo Wavefront OBJ com "precision" casas decimais
+// (precisão negativa utiliza a menor representação que preserva os valores na leitura) formatando
+// trechos do arquivo em paralelo por até "threadCount" threads (zero utiliza todas as threads)
+bool writeObject(const std::string & filename, const TriangleMesh * triangleMesh,
+    int precision = 5, size_t threadCount = 0);
+// Escreve objeto geométrico triangulado de precisão simples para um arquivo Wavefront OBJ (precisão negativa
+// utiliza a menor representação que preserva os valores de precisão simples)
+bool writeObject(const std::string & filename, const TriangleMeshf * triangleMesh,
+    int precision = 5, size_t threadCount = 0);
+// Lê geometria de um arquivo binário nativo (mapeado em memória sem conversão de texto)
+TriangleMesh * readBinaryMesh(const std::string & filename);
+// Escreve geometria para um arquivo binário nativo (versão, alinhamento e soma de verificação)
+bool writeBinaryMesh(const std::string & filename, const TriangleMesh * triangleMesh);
+// Exibe objeto geométrico em uma "viewport" 3D
+void showObject(const TriangleMesh * triangleMesh);
+
+#endif
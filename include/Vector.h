@@ -1,162 +1,481 @@
-// File:    Vector.h
-// Author:  Danilo Peixoto
-// Date:    12/08/2018
-
-// Evita redefinio de smbolos do arquivo de cabealho (caso j tenha sido includo)
-#ifndef CGC_VECTOR_H
-#define CGC_VECTOR_H
-
-#include <ostream>
-
-// Declarao de tipo incompleto no cabealho evita dependncia cclica de arquivos
-class Matrix2;
-class Matrix3;
-class Matrix4;
-
-// Vetor real 1x2
-class Vector2 {
-public:
-    // Componentes do vetor
-    double x, y;
-
-    // Construtor padro (vetor zero)
-    Vector2();
-    // Construtor cpia
-    Vector2(const Vector2 & vector2);
-    // Construtor para valores iniciais
-    Vector2(double x, double y);
-    // Destrutor padro
-    ~Vector2();
-
-    // Sobrecarga da operao "vetor[i]" (retorno mutvel)
-    double & operator [](size_t i);
-    // Sobrecarga da operao "vetor[i]" (retorno imutvel)
-    const double & operator [](size_t i) const;
-    // Sobrecarga da operao "+vetor"
-    Vector2 operator +() const;
-    // Sobrecarga da operao "-vetor"
-    Vector2 operator -() const;
-    // Sobrecarga da operao "vetorA + vetorB"
-    Vector2 operator +(const Vector2 & rhs) const;
-    // Sobrecarga da operao "vetorA - vetorB"
-    Vector2 operator -(const Vector2 & rhs) const;
-    // Sobrecarga da operao "vetor * matriz2"
-    Vector2 operator *(const Matrix2 & rhs) const;
-    // Sobrecarga da operao "matriz2 * vetor"
-    friend Vector2 operator *(const Matrix2 & lhs, const Vector2 & rhs);
-    // Sobrecarga da operao "vetor * matriz3"
-    Vector2 operator *(const Matrix3 & rhs) const;
-    // Sobrecarga da operao "matriz3 * vetor"
-    friend Vector2 operator *(const Matrix3 & lhs, const Vector2 & rhs);
-    // Sobrecarga da operao "vetor * escalar"
-    Vector2 operator *(double rhs) const;
-    // Sobrecarga da operao "escalar * vetor"
-    friend Vector2 operator *(double lhs, const Vector2 & rhs);
-    // Sobrecarga da operao "vetor / escalar"
-    Vector2 operator /(double rhs) const;
-    // Sobrecarga da operao "vetorA += vetorB"
-    Vector2 & operator +=(const Vector2 & rhs);
-    // Sobrecarga da operao "vetorA -= vetorB"
-    Vector2 & operator -=(const Vector2 & rhs);
-    // Sobrecarga da operao "vetor *= matrix2"
-    Vector2 & operator *=(const Matrix2 & rhs);
-    // Sobrecarga da operao "vetor *= matrix3"
-    Vector2 & operator *=(const Matrix3 & rhs);
-    // Sobrecarga da operao "vetor *= escalar"
-    Vector2 & operator *=(double rhs);
-    // Sobrecarga da operao "vetor /= escalar"
-    Vector2 & operator /=(double rhs);
-    // Sobrecarga da operao "vetorA == vetorB"
-    bool operator ==(const Vector2 & rhs) const;
-    // Sobrecarga da operao "vetorA != vetorB"
-    bool operator !=(const Vector2 & rhs) const;
-    // Sobrecarga da operao "sada << vetor" (imprimir sada de dados)
-    friend std::ostream & operator <<(std::ostream & lhs, const Vector2 & rhs);
-
-    // Retorna produto escalar
-    double dot(const Vector2 & rhs) const;
-    // Retorna produto vetorial
-    double cross(const Vector2 & rhs) const;
-    // Normaliza vetor (vetor unitrio)
-    Vector2 & normalize();
-    // Retorna comprimento do vetor ao quadrado
-    double length2() const;
-    // Retorna comprimento do vetor
-    double length() const;
-};
-
-// Vetor real 1x3
-class Vector3 {
-public:
-    // Componentes do vetor
-    double x, y, z;
-
-    // Construtor padro (vetor zero)
-    Vector3();
-    // Construtor cpia
-    Vector3(const Vector3 & vector3);
-    // Construtor para valores iniciais
-    Vector3(double x, double y, double z);
-    // Destrutor padro
-    ~Vector3();
-
-    // Sobrecarga da operao "vetor[i]" (retorno mutvel)
-    double & operator [](size_t i);
-    // Sobrecarga da operao "vetor[i]" (retorno imutvel)
-    const double & operator [](size_t i) const;
-    // Sobrecarga da operao "+vetor"
-    Vector3 operator +() const;
-    // Sobrecarga da operao "-vetor"
-    Vector3 operator -() const;
-    // Sobrecarga da operao "vetorA + vetorB"
-    Vector3 operator +(const Vector3 & rhs) const;
-    // Sobrecarga da operao "vetorA - vetorB"
-    Vector3 operator -(const Vector3 & rhs) const;
-    // Sobrecarga da operao "vetor * matriz3"
-    Vector3 operator *(const Matrix3 & rhs) const;
-    // Sobrecarga da operao "matriz3 * vetor"
-    friend Vector3 operator *(const Matrix3 & lhs, const Vector3 & rhs);
-    // Sobrecarga da operao "vetor * matriz4"
-    Vector3 operator *(const Matrix4 & rhs) const;
-    // Sobrecarga da operao "matriz4 * vetor"
-    friend Vector3 operator *(const Matrix4 & lhs, const Vector3 & rhs);
-    // Sobrecarga da operao "vetor * escalar"
-    Vector3 operator *(double rhs) const;
-    // Sobrecarga da operao "escalar * vetor"
-    friend Vector3 operator *(double lhs, const Vector3 & rhs);
-    // Sobrecarga da operao "vetor / escalar"
-    Vector3 operator /(double rhs) const;
-    // Sobrecarga da operao "vetorA += vetorB"
-    Vector3 & operator +=(const Vector3 & rhs);
-    // Sobrecarga da operao "vetorA -= vetorB"
-    Vector3 & operator -=(const Vector3 & rhs);
-    // Sobrecarga da operao "vetor *= matrix3"
-    Vector3 & operator *=(const Matrix3 & rhs);
-    // Sobrecarga da operao "vetor *= matrix4"
-    Vector3 & operator *=(const Matrix4 & rhs);
-    // Sobrecarga da operao "vetor *= escalar"
-    Vector3 & operator *=(double rhs);
-    // Sobrecarga da operao "vetor /= escalar"
-    Vector3 & operator /=(double rhs);
-    // Sobrecarga da operao "vetorA == vetorB"
-    bool operator ==(const Vector3 & rhs) const;
-    // Sobrecarga da operao "vetorA != vetorB"
-    bool operator !=(const Vector3 & rhs) const;
-    // Sobrecarga da operao "sada << vetor" (imprimir sada de dados)
-    friend std::ostream & operator <<(std::ostream & lhs, const Vector3 & rhs);
-
-    // Retorna produto escalar
-    double dot(const Vector3 & rhs) const;
-    // Retorna produto triplo ou misto
-    double triple(const Vector3 & a, const Vector3 & b) const;
-    // Retorna produto vetorial
-    Vector3 cross(const Vector3 & rhs) const;
-    // Normaliza vetor (vetor unitrio)
-    Vector3 & normalize();
-    // Retorna comprimento do vetor ao quadrado
-    double length2() const;
-    // Retorna comprimento do vetor
-    double length() const;
-};
-
-#endif
\ No newline at end of file
+// File:    Vector.h
+// Author:  Danilo Peixoto
+// Date:    12/08/2018
+
+// Evita redefinição de símbolos do arquivo de cabeçalho (caso já tenha sido incluído)
+#ifndef CGC_VECTOR_H
+#define CGC_VECTOR_H
+
+#include <Global.h>
+
+#include <ostream>
+#include <cmath>
+
+// Declaração de tipo incompleto no cabeçalho evita dependência cíclica de arquivos
+class Matrix2;
+class Matrix3;
+class Matrix4;
+class Vector2f;
+class Vector3f;
+
+// Vetor real 1x2
+class Vector2 {
+public:
+    // Componentes do vetor
+    double x, y;
+
+    // Construtor padrão (vetor zero)
+    constexpr Vector2();
+    // Construtor cópia (cópia trivial)
+    Vector2(const Vector2 & vector2) = default;
+    // Construtor para valores iniciais
+    constexpr Vector2(double x, double y);
+    // Construtor de conversão de precisão simples
+    explicit constexpr Vector2(const Vector2f & vector2f);
+    // Destrutor padrão (trivial)
+    ~Vector2() = default;
+
+    // Sobrecarga da operação "vetor[i]" (retorno mutável)
+    double & operator [](size_t i);
+    // Sobrecarga da operação "vetor[i]" (retorno imutável)
+    const double & operator [](size_t i) const;
+    // Sobrecarga da operação "+vetor"
+    constexpr Vector2 operator +() const;
+    // Sobrecarga da operação "-vetor"
+    constexpr Vector2 operator -() const;
+    // Sobrecarga da operação "vetorA + vetorB"
+    constexpr Vector2 operator +(const Vector2 & rhs) const;
+    // Sobrecarga da operação "vetorA - vetorB"
+    constexpr Vector2 operator -(const Vector2 & rhs) const;
+    // Sobrecarga da operação "vetor * matriz2"
+    Vector2 operator *(const Matrix2 & rhs) const;
+    // Sobrecarga da operação "matriz2 * vetor"
+    friend Vector2 operator *(const Matrix2 & lhs, const Vector2 & rhs);
+    // Sobrecarga da operação "vetor * matriz3"
+    Vector2 operator *(const Matrix3 & rhs) const;
+    // Sobrecarga da operação "matriz3 * vetor"
+    friend Vector2 operator *(const Matrix3 & lhs, const Vector2 & rhs);
+    // Sobrecarga da operação "vetor * escalar"
+    constexpr Vector2 operator *(double rhs) const;
+    // Sobrecarga da operação "escalar * vetor"
+    friend constexpr Vector2 operator *(double lhs, const Vector2 & rhs);
+    // Sobrecarga da operação "vetor / escalar"
+    constexpr Vector2 operator /(double rhs) const;
+    // Sobrecarga da operação "vetorA += vetorB"
+    Vector2 & operator +=(const Vector2 & rhs);
+    // Sobrecarga da operação "vetorA -= vetorB"
+    Vector2 & operator -=(const Vector2 & rhs);
+    // Sobrecarga da operação "vetor *= matrix2"
+    Vector2 & operator *=(const Matrix2 & rhs);
+    // Sobrecarga da operação "vetor *= matrix3"
+    Vector2 & operator *=(const Matrix3 & rhs);
+    // Sobrecarga da operação "vetor *= escalar"
+    Vector2 & operator *=(double rhs);
+    // Sobrecarga da operação "vetor /= escalar"
+    Vector2 & operator /=(double rhs);
+    // Sobrecarga da operação "vetorA == vetorB"
+    constexpr bool operator ==(const Vector2 & rhs) const;
+    // Sobrecarga da operação "vetorA != vetorB"
+    constexpr bool operator !=(const Vector2 & rhs) const;
+    // Sobrecarga da operação "saída << vetor" (imprimir saída de dados)
+    friend std::ostream & operator <<(std::ostream & lhs, const Vector2 & rhs);
+
+    // Retorna produto escalar
+    constexpr double dot(const Vector2 & rhs) const;
+    // Retorna produto vetorial
+    constexpr double cross(const Vector2 & rhs) const;
+    // Normaliza vetor (vetor unitário)
+    Vector2 & normalize();
+    // Retorna comprimento do vetor ao quadrado
+    constexpr double length2() const;
+    // Retorna comprimento do vetor
+    double length() const;
+};
+
+// Vetor real 1x3
+class Vector3 {
+public:
+    // Componentes do vetor
+    double x, y, z;
+
+    // Construtor padrão (vetor zero)
+    constexpr Vector3();
+    // Construtor cópia (cópia trivial)
+    Vector3(const Vector3 & vector3) = default;
+    // Construtor para valores iniciais
+    constexpr Vector3(double x, double y, double z);
+    // Construtor de conversão de precisão simples
+    explicit constexpr Vector3(const Vector3f & vector3f);
+    // Destrutor padrão (trivial)
+    ~Vector3() = default;
+
+    // Sobrecarga da operação "vetor[i]" (retorno mutável)
+    double & operator [](size_t i);
+    // Sobrecarga da operação "vetor[i]" (retorno imutável)
+    const double & operator [](size_t i) const;
+    // Sobrecarga da operação "+vetor"
+    constexpr Vector3 operator +() const;
+    // Sobrecarga da operação "-vetor"
+    constexpr Vector3 operator -() const;
+    // Sobrecarga da operação "vetorA + vetorB"
+    constexpr Vector3 operator +(const Vector3 & rhs) const;
+    // Sobrecarga da operação "vetorA - vetorB"
+    constexpr Vector3 operator -(const Vector3 & rhs) const;
+    // Sobrecarga da operação "vetor * matriz3"
+    Vector3 operator *(const Matrix3 & rhs) const;
+    // Sobrecarga da operação "matriz3 * vetor"
+    friend Vector3 operator *(const Matrix3 & lhs, const Vector3 & rhs);
+    // Sobrecarga da operação "vetor * matriz4"
+    Vector3 operator *(const Matrix4 & rhs) const;
+    // Sobrecarga da operação "matriz4 * vetor"
+    friend Vector3 operator *(const Matrix4 & lhs, const Vector3 & rhs);
+    // Sobrecarga da operação "vetor * escalar"
+    constexpr Vector3 operator *(double rhs) const;
+    // Sobrecarga da operação "escalar * vetor"
+    friend constexpr Vector3 operator *(double lhs, const Vector3 & rhs);
+    // Sobrecarga da operação "vetor / escalar"
+    constexpr Vector3 operator /(double rhs) const;
+    // Sobrecarga da operação "vetorA += vetorB"
+    Vector3 & operator +=(const Vector3 & rhs);
+    // Sobrecarga da operação "vetorA -= vetorB"
+    Vector3 & operator -=(const Vector3 & rhs);
+    // Sobrecarga da operação "vetor *= matrix3"
+    Vector3 & operator *=(const Matrix3 & rhs);
+    // Sobrecarga da operação "vetor *= matrix4"
+    Vector3 & operator *=(const Matrix4 & rhs);
+    // Sobrecarga da operação "vetor *= escalar"
+    Vector3 & operator *=(double rhs);
+    // Sobrecarga da operação "vetor /= escalar"
+    Vector3 & operator /=(double rhs);
+    // Sobrecarga da operação "vetorA == vetorB"
+    constexpr bool operator ==(const Vector3 & rhs) const;
+    // Sobrecarga da operação "vetorA != vetorB"
+    constexpr bool operator !=(const Vector3 & rhs) const;
+    // Sobrecarga da operação "saída << vetor" (imprimir saída de dados)
+    friend std::ostream & operator <<(std::ostream & lhs, const Vector3 & rhs);
+
+    // Retorna produto escalar
+    constexpr double dot(const Vector3 & rhs) const;
+    // Retorna produto triplo ou misto
+    constexpr double triple(const Vector3 & a, const Vector3 & b) const;
+    // Retorna produto vetorial
+    constexpr Vector3 cross(const Vector3 & rhs) const;
+    // Normaliza vetor (vetor unitário)
+    Vector3 & normalize();
+    // Retorna comprimento do vetor ao quadrado
+    constexpr double length2() const;
+    // Retorna comprimento do vetor
+    double length() const;
+};
+
+// Vetor real 1x2 de precisão simples (armazenamento compacto de atributos)
+class Vector2f {
+public:
+    // Componentes do vetor
+    float x, y;
+
+    // Construtor padrão (vetor zero)
+    constexpr Vector2f();
+    // Construtor cópia (cópia trivial)
+    Vector2f(const Vector2f & vector2f) = default;
+    // Construtor para valores iniciais
+    constexpr Vector2f(float x, float y);
+    // Construtor de conversão de precisão dupla (valores arredondados)
+    explicit constexpr Vector2f(const Vector2 & vector2);
+    // Destrutor padrão (trivial)
+    ~Vector2f() = default;
+
+    // Sobrecarga da operação "vetor[i]" (retorno mutável)
+    float & operator [](size_t i);
+    // Sobrecarga da operação "vetor[i]" (retorno imutável)
+    const float & operator [](size_t i) const;
+    // Sobrecarga da operação "vetorA == vetorB"
+    constexpr bool operator ==(const Vector2f & rhs) const;
+    // Sobrecarga da operação "vetorA != vetorB"
+    constexpr bool operator !=(const Vector2f & rhs) const;
+    // Sobrecarga da operação "saída << vetor" (imprimir saída de dados)
+    friend std::ostream & operator <<(std::ostream & lhs, const Vector2f & rhs);
+};
+
+// Vetor real 1x3 de precisão simples (armazenamento compacto de atributos)
+class Vector3f {
+public:
+    // Componentes do vetor
+    float x, y, z;
+
+    // Construtor padrão (vetor zero)
+    constexpr Vector3f();
+    // Construtor cópia (cópia trivial)
+    Vector3f(const Vector3f & vector3f) = default;
+    // Construtor para valores iniciais
+    constexpr Vector3f(float x, float y, float z);
+    // Construtor de conversão de precisão dupla (valores arredondados)
+    explicit constexpr Vector3f(const Vector3 & vector3);
+    // Destrutor padrão (trivial)
+    ~Vector3f() = default;
+
+    // Sobrecarga da operação "vetor[i]" (retorno mutável)
+    float & operator [](size_t i);
+    // Sobrecarga da operação "vetor[i]" (retorno imutável)
+    const float & operator [](size_t i) const;
+    // Sobrecarga da operação "vetor *= matrix4"
+    Vector3f & operator *=(const Matrix4 & rhs);
+    // Sobrecarga da operação "vetorA == vetorB"
+    constexpr bool operator ==(const Vector3f & rhs) const;
+    // Sobrecarga da operação "vetorA != vetorB"
+    constexpr bool operator !=(const Vector3f & rhs) const;
+    // Sobrecarga da operação "saída << vetor" (imprimir saída de dados)
+    friend std::ostream & operator <<(std::ostream & lhs, const Vector3f & rhs);
+
+    // Normaliza vetor (vetor unitário)
+    Vector3f & normalize();
+    // Retorna comprimento do vetor ao quadrado
+    constexpr float length2() const;
+    // Retorna comprimento do vetor
+    float length() const;
+};
+
+constexpr Vector2::Vector2() : x(0), y(0) {}
+constexpr Vector2::Vector2(double x, double y) : x(x), y(y) {}
+constexpr Vector2::Vector2(const Vector2f & vector2f) : x(vector2f.x), y(vector2f.y) {}
+
+inline double & Vector2::operator [](size_t i) {
+    return (&x)[i];
+}
+inline const double & Vector2::operator [](size_t i) const {
+    return (&x)[i];
+}
+constexpr Vector2 Vector2::operator +() const {
+    return *this;
+}
+constexpr Vector2 Vector2::operator -() const {
+    return Vector2(-x, -y);
+}
+constexpr Vector2 Vector2::operator +(const Vector2 & rhs) const {
+    return Vector2(x + rhs.x, y + rhs.y);
+}
+constexpr Vector2 Vector2::operator -(const Vector2 & rhs) const {
+    return Vector2(x - rhs.x, y - rhs.y);
+}
+constexpr Vector2 Vector2::operator *(double rhs) const {
+    return Vector2(x * rhs, y * rhs);
+}
+constexpr Vector2 operator *(double lhs, const Vector2 & rhs) {
+    return rhs * lhs;
+}
+constexpr Vector2 Vector2::operator /(double rhs) const {
+    return Vector2(x / rhs, y / rhs);
+}
+inline Vector2 & Vector2::operator +=(const Vector2 & rhs) {
+    x += rhs.x;
+    y += rhs.y;
+
+    return *this;
+}
+inline Vector2 & Vector2::operator -=(const Vector2 & rhs) {
+    x -= rhs.x;
+    y -= rhs.y;
+
+    return *this;
+}
+inline Vector2 & Vector2::operator *=(double rhs) {
+    x *= rhs;
+    y *= rhs;
+
+    return *this;
+}
+inline Vector2 & Vector2::operator /=(double rhs) {
+    x /= rhs;
+    y /= rhs;
+
+    return *this;
+}
+constexpr bool Vector2::operator ==(const Vector2 & rhs) const {
+    return x == rhs.x && y == rhs.y;
+}
+constexpr bool Vector2::operator !=(const Vector2 & rhs) const {
+    return !(*this == rhs);
+}
+inline std::ostream & operator <<(std::ostream & lhs, const Vector2 & rhs) {
+    return lhs << '(' << rhs.x << ' ' << rhs.y << ')';
+}
+
+constexpr double Vector2::dot(const Vector2 & rhs) const {
+    return x * rhs.x + y * rhs.y;
+}
+constexpr double Vector2::cross(const Vector2 & rhs) const {
+    return x * rhs.y - y * rhs.x;
+}
+inline Vector2 & Vector2::normalize() {
+    double l2 = length2();
+
+    if (l2 > CGC_EPSILON)
+        *this /= std::sqrt(l2);
+
+    return *this;
+}
+constexpr double Vector2::length2() const {
+    return dot(*this);
+}
+inline double Vector2::length() const {
+    return std::sqrt(length2());
+}
+
+constexpr Vector3::Vector3() : x(0), y(0), z(0) {}
+constexpr Vector3::Vector3(double x, double y, double z) : x(x), y(y), z(z) {}
+constexpr Vector3::Vector3(const Vector3f & vector3f) : x(vector3f.x), y(vector3f.y), z(vector3f.z) {}
+
+inline double & Vector3::operator [](size_t i) {
+    return (&x)[i];
+}
+inline const double & Vector3::operator [](size_t i) const {
+    return (&x)[i];
+}
+constexpr Vector3 Vector3::operator +() const {
+    return *this;
+}
+constexpr Vector3 Vector3::operator -() const {
+    return Vector3(-x, -y, -z);
+}
+constexpr Vector3 Vector3::operator +(const Vector3 & rhs) const {
+    return Vector3(x + rhs.x, y + rhs.y, z + rhs.z);
+}
+constexpr Vector3 Vector3::operator -(const Vector3 & rhs) const {
+    return Vector3(x - rhs.x, y - rhs.y, z - rhs.z);
+}
+constexpr Vector3 Vector3::operator *(double rhs) const {
+    return Vector3(x * rhs, y * rhs, z * rhs);
+}
+constexpr Vector3 operator *(double lhs, const Vector3 & rhs) {
+    return rhs * lhs;
+}
+constexpr Vector3 Vector3::operator /(double rhs) const {
+    return Vector3(x / rhs, y / rhs, z / rhs);
+}
+inline Vector3 & Vector3::operator +=(const Vector3 & rhs) {
+    x += rhs.x;
+    y += rhs.y;
+    z += rhs.z;
+
+    return *this;
+}
+inline Vector3 & Vector3::operator -=(const Vector3 & rhs) {
+    x -= rhs.x;
+    y -= rhs.y;
+    z -= rhs.z;
+
+    return *this;
+}
+inline Vector3 & Vector3::operator *=(double rhs) {
+    x *= rhs;
+    y *= rhs;
+    z *= rhs;
+
+    return *this;
+}
+inline Vector3 & Vector3::operator /=(double rhs) {
+    x /= rhs;
+    y /= rhs;
+    z /= rhs;
+
+    return *this;
+}
+constexpr bool Vector3::operator ==(const Vector3 & rhs) const {
+    return x == rhs.x && y == rhs.y && z == rhs.z;
+}
+constexpr bool Vector3::operator !=(const Vector3 & rhs) const {
+    return !(*this == rhs);
+}
+inline std::ostream & operator <<(std::ostream & lhs, const Vector3 & rhs) {
+    return lhs << '(' << rhs.x << ' ' << rhs.y << ' ' << rhs.z << ')';
+}
+
+constexpr double Vector3::dot(const Vector3 & rhs) const {
+    return x * rhs.x + y * rhs.y + z * rhs.z;
+}
+constexpr double Vector3::triple(const Vector3 & a, const Vector3 & b) const {
+    return dot(a.cross(b));
+}
+constexpr Vector3 Vector3::cross(const Vector3 & rhs) const {
+    return Vector3(y * rhs.z - z * rhs.y, z * rhs.x - x * rhs.z, x * rhs.y - y * rhs.x);
+}
+inline Vector3 & Vector3::normalize() {
+    double l2 = length2();
+
+    if (l2 > CGC_EPSILON)
+        *this /= std::sqrt(l2);
+
+    return *this;
+}
+constexpr double Vector3::length2() const {
+    return dot(*this);
+}
+inline double Vector3::length() const {
+    return std::sqrt(length2());
+}
+
+constexpr Vector2f::Vector2f() : x(0), y(0) {}
+constexpr Vector2f::Vector2f(float x, float y) : x(x), y(y) {}
+constexpr Vector2f::Vector2f(const Vector2 & vector2) : x((float)vector2.x), y((float)vector2.y) {}
+
+inline float & Vector2f::operator [](size_t i) {
+    return (&x)[i];
+}
+inline const float & Vector2f::operator [](size_t i) const {
+    return (&x)[i];
+}
+constexpr bool Vector2f::operator ==(const Vector2f & rhs) const {
+    return x == rhs.x && y == rhs.y;
+}
+constexpr bool Vector2f::operator !=(const Vector2f & rhs) const {
+    return !(*this == rhs);
+}
+inline std::ostream & operator <<(std::ostream & lhs, const Vector2f & rhs) {
+    return lhs << '(' << rhs.x << ' ' << rhs.y << ')';
+}
+
+constexpr Vector3f::Vector3f() : x(0), y(0), z(0) {}
+constexpr Vector3f::Vector3f(float x, float y, float z) : x(x), y(y), z(z) {}
+constexpr Vector3f::Vector3f(const Vector3 & vector3)
+    : x((float)vector3.x), y((float)vector3.y), z((float)vector3.z) {}
+
+inline float & Vector3f::operator [](size_t i) {
+    return (&x)[i];
+}
+inline const float & Vector3f::operator [](size_t i) const {
+    return (&x)[i];
+}
+constexpr bool Vector3f::operator ==(const Vector3f & rhs) const {
+    return x == rhs.x && y == rhs.y && z == rhs.z;
+}
+constexpr bool Vector3f::operator !=(const Vector3f & rhs) const {
+    return !(*this == rhs);
+}
+inline std::ostream & operator <<(std::ostream & lhs, const Vector3f & rhs) {
+    return lhs << '(' << rhs.x << ' ' << rhs.y << ' ' << rhs.z << ')';
+}
+
+inline Vector3f & Vector3f::normalize() {
+    float l2 = length2();
+
+    if (l2 > CGC_EPSILON) {
+        float s = 1.0f / std::sqrt(l2);
+
+        x *= s;
+        y *= s;
+        z *= s;
+    }
+
+    return *this;
+}
+constexpr float Vector3f::length2() const {
+    return x * x + y * y + z * z;
+}
+inline float Vector3f::length() const {
+    return std::sqrt(length2());
+}
+
+// Operações entre vetores e matrizes são definidas após a declaração das matrizes
+#include <Matrix.h>
+
+#endif
@@ -0,0 +1,88 @@
+// File:    VertexBuffer.h
+// Author:  Danilo Peixoto
+// Date:    17/10/2026
+
+// Evita redefinição de símbolos do arquivo de cabeçalho (caso já tenha sido incluído)
+#ifndef CGC_VERTEX_BUFFER_H
+#define CGC_VERTEX_BUFFER_H
+
+#include <Vector.h>
+#include <IndexBuffer.h>
+
+#include <vector>
+
+// Declaração de tipo incompleto no cabeçalho evita dependência cíclica de arquivos
+class TriangleMesh;
+class TriangleMeshf;
+
+// Vértice com atributos intercalados em precisão simples
+class Vertex {
+public:
+    Vector3f position; // Posição
+    Vector3f normal; // Vetor normal
+    Vector2f textureCoordinates; // Coordenadas de textura
+
+    // Construtor padrão (atributos nulos)
+    Vertex();
+    // Construtor para valores iniciais
+    Vertex(const Vector3f & position, const Vector3f & normal, const Vector2f & textureCoordinates);
+    // Destrutor padrão
+    ~Vertex();
+
+    // Sobrecarga da operação "vérticeA == vérticeB"
+    bool operator ==(const Vertex & rhs) const;
+    // Sobrecarga da operação "vérticeA != vérticeB"
+    bool operator !=(const Vertex & rhs) const;
+};
+
+// Lista de vértices intercalados únicos com uma única lista de índices por triângulo (formato de
+// envio para placas gráficas, obtido pela soldagem das combinações de índices de uma geometria)
+class VertexBuffer {
+private:
+    std::vector<Vertex> vertices; // Lista de vértices únicos
+    IndexBuffer indices; // Lista de índices de vértices por triângulo
+    bool normals; // Estado de presença de vetores normais
+    bool textureCoordinates; // Estado de presença de coordenadas de textura
+
+public:
+    // Construtor padrão (lista vazia)
+    VertexBuffer();
+    // Construtor para geometria de precisão dupla
+    VertexBuffer(const TriangleMesh & triangleMesh);
+    // Construtor para geometria de precisão simples
+    VertexBuffer(const TriangleMeshf & triangleMesh);
+    // Destrutor padrão
+    ~VertexBuffer();
+
+    // Retorna lista de vértices
+    const std::vector<Vertex> & getVertices() const;
+    // Retorna lista de índices de vértices por triângulo
+    const IndexBuffer & getIndices() const;
+    // Retorna vértice pelo índice
+    const Vertex & getVertex(size_t i) const;
+    // Retorna índices dos vértices de um triângulo
+    void getIndices(size_t i, size_t & v0, size_t & v1, size_t & v2) const;
+    // Retorna número de vértices
+    size_t getVertexCount() const;
+    // Retorna número de triângulos
+    size_t getTriangleCount() const;
+    // Retorna distância em bytes entre vértices consecutivos
+    size_t getStride() const;
+    // Verifica se vértices têm vetores normais
+    bool hasNormals() const;
+    // Verifica se vértices têm coordenadas de textura
+    bool hasTextureCoordinates() const;
+
+    // Cria lista a partir de geometria de precisão dupla (uma entrada por combinação única de índices)
+    VertexBuffer & create(const TriangleMesh & triangleMesh);
+    // Cria lista a partir de geometria de precisão simples (uma entrada por combinação única de índices)
+    VertexBuffer & create(const TriangleMeshf & triangleMesh);
+    // Remove todos vértices e índices
+    VertexBuffer & clear();
+    // Reordena triângulos (triângulo "i" passa a ser o triângulo "order[i]")
+    VertexBuffer & reorderTriangles(const std::vector<size_t> & order);
+    // Reordena vértices e atualiza índices (vértice "i" passa à posição "remap[i]")
+    VertexBuffer & reorderVertices(const std::vector<size_t> & remap);
+};
+
+#endif
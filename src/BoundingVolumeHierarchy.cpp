@@ -0,0 +1,639 @@
+// File:    BoundingVolumeHierarchy.cpp
+// Author:  Danilo Peixoto
+// Date:    17/10/2026
+
+#include <BoundingVolumeHierarchy.h>
+#include <TriangleMesh.h>
+#include <Thread.h>
+
+#include <algorithm>
+#include <limits>
+#include <cmath>
+
+// Número de intervalos por eixo na avaliação do custo SAH
+static const size_t binCount = 16;
+// Faixas maiores que este limite calculam caixas e intervalos em paralelo
+static const size_t parallelRangeSize = 1 << 17;
+// Marca nó dos níveis superiores que não é uma subárvore
+static const size_t noSubtree = std::numeric_limits<size_t>::max();
+
+// Caixa envolvente em precisão simples
+struct Bounds {
+    float minimum[3]; // Canto mínimo
+    float maximum[3]; // Canto máximo
+
+    // Esvazia caixa (mínimo infinito e máximo negativo infinito)
+    void reset() {
+        for (size_t k = 0; k < 3; k++) {
+            minimum[k] = std::numeric_limits<float>::infinity();
+            maximum[k] = -std::numeric_limits<float>::infinity();
+        }
+    }
+    // Inclui outra caixa
+    void extend(const Bounds & bounds) {
+        for (size_t k = 0; k < 3; k++) {
+            minimum[k] = std::min(minimum[k], bounds.minimum[k]);
+            maximum[k] = std::max(maximum[k], bounds.maximum[k]);
+        }
+    }
+    // Inclui ponto
+    void extend(const float * point) {
+        for (size_t k = 0; k < 3; k++) {
+            minimum[k] = std::min(minimum[k], point[k]);
+            maximum[k] = std::max(maximum[k], point[k]);
+        }
+    }
+    // Retorna área da superfície (zero para caixa vazia)
+    float getSurfaceArea() const {
+        float x = maximum[0] - minimum[0], y = maximum[1] - minimum[1], z = maximum[2] - minimum[2];
+
+        if (x < 0 || y < 0 || z < 0)
+            return 0;
+
+        return 2 * (x * y + y * z + z * x);
+    }
+};
+
+// Intervalo de centróides na avaliação do custo SAH
+struct Bin {
+    Bounds bounds; // Caixa dos triângulos do intervalo
+    size_t count; // Número de triângulos do intervalo
+};
+
+// Triângulo durante a construção (caixa junto ao índice evita acessos indiretos após as partições)
+struct TriangleReference {
+    Bounds bounds; // Caixa do triângulo
+    uint32_t triangle; // Índice do triângulo
+
+    // Retorna dobro do centróide (evita multiplicação por meio)
+    void getCentroid(float * centroid) const {
+        for (size_t k = 0; k < 3; k++)
+            centroid[k] = bounds.minimum[k] + bounds.maximum[k];
+    }
+    // Retorna dobro da coordenada do centróide no eixo
+    float getCentroid(size_t axis) const {
+        return bounds.minimum[axis] + bounds.maximum[axis];
+    }
+};
+
+// Arredonda para o maior valor de precisão simples menor ou igual ao valor
+static float roundDown(double value) {
+    float result = (float)value;
+    return result > value ? std::nextafter(result, -std::numeric_limits<float>::infinity()) : result;
+}
+// Arredonda para o menor valor de precisão simples maior ou igual ao valor
+static float roundUp(double value) {
+    float result = (float)value;
+    return result < value ? std::nextafter(result, std::numeric_limits<float>::infinity()) : result;
+}
+// Calcula caixa de cada triângulo em paralelo (arredondada para fora em precisão simples)
+template<typename Mesh, typename Vector3Type>
+static void computeTriangleBounds(const Mesh & triangleMesh, std::vector<TriangleReference> & references,
+    size_t threadCount) {
+    references.resize(triangleMesh.getTriangleCount());
+
+    threadPool.run(0, references.size(), parallelRangeSize, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            size_t v0, v1, v2;
+            triangleMesh.getVertexIndices(i, v0, v1, v2);
+
+            const Vector3Type & p0 = triangleMesh.getVertex(v0);
+            const Vector3Type & p1 = triangleMesh.getVertex(v1);
+            const Vector3Type & p2 = triangleMesh.getVertex(v2);
+
+            Bounds & bounds = references[i].bounds;
+
+            for (size_t k = 0; k < 3; k++) {
+                bounds.minimum[k] = roundDown(std::min(p0[k], std::min(p1[k], p2[k])));
+                bounds.maximum[k] = roundUp(std::max(p0[k], std::max(p1[k], p2[k])));
+            }
+
+            references[i].triangle = (uint32_t)i;
+        }
+    }, threadCount);
+}
+
+// Nó dos níveis superiores construídos antes das subárvores paralelas
+struct BuildNode {
+    BoundingVolumeNode node; // Nó final (exceto para subárvores)
+    size_t left, right; // Índices dos filhos nos níveis superiores
+    size_t subtree; // Índice da subárvore ou "noSubtree" para nó dos níveis superiores
+};
+
+// Estado compartilhado da construção
+struct BoundingVolumeBuilder {
+    TriangleReference * references; // Triângulos (particionados durante a construção)
+    size_t maximumLeafSize; // Número máximo de triângulos por folha
+    size_t threadCount; // Número de threads
+
+    // Calcula caixa dos triângulos e caixa dos centróides da faixa
+    void computeBounds(size_t begin, size_t end, Bounds & nodeBounds, Bounds & centroidBounds,
+        bool parallel) const {
+        nodeBounds.reset();
+        centroidBounds.reset();
+
+        if (!parallel) {
+            for (size_t i = begin; i < end; i++) {
+                float centroid[3];
+                references[i].getCentroid(centroid);
+
+                nodeBounds.extend(references[i].bounds);
+                centroidBounds.extend(centroid);
+            }
+
+            return;
+        }
+
+        size_t blockCount = std::min((end - begin) / parallelRangeSize + 1, threadCount * 4);
+        size_t blockSize = (end - begin + blockCount - 1) / blockCount;
+        std::vector<Bounds> blockBounds(blockCount * 2);
+
+        threadPool.run(blockCount, [&](size_t i) {
+            size_t blockBegin = begin + i * blockSize;
+            computeBounds(blockBegin, std::min(blockBegin + blockSize, end),
+                blockBounds[i * 2], blockBounds[i * 2 + 1], false);
+        }, threadCount);
+
+        for (size_t i = 0; i < blockCount; i++) {
+            nodeBounds.extend(blockBounds[i * 2]);
+            centroidBounds.extend(blockBounds[i * 2 + 1]);
+        }
+    }
+    // Distribui centróides da faixa nos intervalos dos três eixos
+    void computeBins(size_t begin, size_t end, const Bounds & centroidBounds, Bin * bins,
+        bool parallel) const {
+        for (size_t i = 0; i < binCount * 3; i++) {
+            bins[i].bounds.reset();
+            bins[i].count = 0;
+        }
+
+        if (!parallel) {
+            float scale[3];
+
+            for (size_t k = 0; k < 3; k++) {
+                float extent = centroidBounds.maximum[k] - centroidBounds.minimum[k];
+                scale[k] = extent > 0 ? binCount / extent : 0;
+            }
+
+            for (size_t i = begin; i < end; i++) {
+                float centroid[3];
+                references[i].getCentroid(centroid);
+
+                for (size_t k = 0; k < 3; k++) {
+                    size_t bin = std::min((size_t)((centroid[k] - centroidBounds.minimum[k]) * scale[k]),
+                        binCount - 1);
+
+                    bins[k * binCount + bin].bounds.extend(references[i].bounds);
+                    bins[k * binCount + bin].count++;
+                }
+            }
+
+            return;
+        }
+
+        size_t blockCount = std::min((end - begin) / parallelRangeSize + 1, threadCount * 4);
+        size_t blockSize = (end - begin + blockCount - 1) / blockCount;
+        std::vector<Bin> blockBins(blockCount * binCount * 3);
+
+        threadPool.run(blockCount, [&](size_t i) {
+            size_t blockBegin = begin + i * blockSize;
+            computeBins(blockBegin, std::min(blockBegin + blockSize, end), centroidBounds,
+                &blockBins[i * binCount * 3], false);
+        }, threadCount);
+
+        for (size_t i = 0; i < blockCount; i++) {
+            for (size_t j = 0; j < binCount * 3; j++) {
+                bins[j].bounds.extend(blockBins[i * binCount * 3 + j].bounds);
+                bins[j].count += blockBins[i * binCount * 3 + j].count;
+            }
+        }
+    }
+    // Verifica se folha custa menos que a divisão (custo da divisão sem a travessia e sem normalização)
+    bool isLeafCheaper(size_t count, const Bounds & nodeBounds, float splitCost) const {
+        float area = nodeBounds.getSurfaceArea();
+        return count <= maximumLeafSize && (area <= 0 || 1 + splitCost / area >= count);
+    }
+    // Divide faixa pequena avaliando todas posições entre centróides ordenados em cada eixo
+    bool splitSorted(size_t begin, size_t end, const Bounds & nodeBounds, size_t & middle,
+        size_t & axis) const {
+        size_t count = end - begin;
+        TriangleReference sorted[3][binCount];
+
+        float bestCost = std::numeric_limits<float>::infinity();
+        size_t bestPosition = 0;
+        axis = 0;
+
+        for (size_t k = 0; k < 3; k++) {
+            TriangleReference * order = sorted[k];
+            std::copy(references + begin, references + end, order);
+
+            std::sort(order, order + count, [k](const TriangleReference & a, const TriangleReference & b) {
+                return a.getCentroid(k) < b.getCentroid(k);
+            });
+
+            float leftCost[binCount];
+            Bounds leftBounds, rightBounds;
+
+            leftBounds.reset();
+            rightBounds.reset();
+
+            for (size_t i = 0; i < count - 1; i++) {
+                leftBounds.extend(order[i].bounds);
+                leftCost[i] = leftBounds.getSurfaceArea() * (i + 1);
+            }
+
+            for (size_t i = count - 1; i > 0; i--) {
+                rightBounds.extend(order[i].bounds);
+
+                float cost = leftCost[i - 1] + rightBounds.getSurfaceArea() * (count - i);
+
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    bestPosition = i;
+                    axis = k;
+                }
+            }
+        }
+
+        if (isLeafCheaper(count, nodeBounds, bestCost))
+            return false;
+
+        std::copy(sorted[axis], sorted[axis] + count, references + begin);
+        middle = begin + bestPosition;
+
+        return true;
+    }
+    // Divide faixa pelo menor custo SAH (retorna falso se a faixa deve ser uma folha)
+    bool split(size_t begin, size_t end, const Bounds & nodeBounds, const Bounds & centroidBounds,
+        bool parallel, size_t & middle, size_t & axis) const {
+        size_t count = end - begin;
+
+        if (count <= 1)
+            return false;
+
+        // Intervalos não compensam para poucos triângulos
+        if (count <= binCount)
+            return splitSorted(begin, end, nodeBounds, middle, axis);
+
+        Bin bins[binCount * 3];
+        computeBins(begin, end, centroidBounds, bins, parallel);
+
+        // Custo de cada divisão: travessia unitária mais interseções ponderadas pela área relativa dos filhos
+        float bestCost = std::numeric_limits<float>::infinity();
+        size_t bestBin = 0;
+        axis = 0;
+
+        for (size_t k = 0; k < 3; k++) {
+            if (centroidBounds.maximum[k] <= centroidBounds.minimum[k])
+                continue;
+
+            const Bin * axisBins = &bins[k * binCount];
+            float leftCost[binCount];
+            Bounds leftBounds, rightBounds;
+            size_t leftCount = 0, rightCount = 0;
+
+            leftBounds.reset();
+            rightBounds.reset();
+
+            for (size_t i = 0; i < binCount - 1; i++) {
+                leftBounds.extend(axisBins[i].bounds);
+                leftCount += axisBins[i].count;
+                leftCost[i] = leftBounds.getSurfaceArea() * leftCount;
+            }
+
+            for (size_t i = binCount - 1; i > 0; i--) {
+                rightBounds.extend(axisBins[i].bounds);
+                rightCount += axisBins[i].count;
+
+                float cost = leftCost[i - 1] + rightBounds.getSurfaceArea() * rightCount;
+
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    bestBin = i;
+                    axis = k;
+                }
+            }
+        }
+
+        // Centróides coincidentes: divisão pela mediana apenas para respeitar o tamanho máximo da folha
+        if (bestCost == std::numeric_limits<float>::infinity()) {
+            if (count <= maximumLeafSize)
+                return false;
+
+            middle = begin + count / 2;
+            return true;
+        }
+
+        if (isLeafCheaper(count, nodeBounds, bestCost))
+            return false;
+
+        float minimum = centroidBounds.minimum[axis];
+        float scale = binCount / (centroidBounds.maximum[axis] - centroidBounds.minimum[axis]);
+        size_t k = axis;
+
+        middle = std::partition(references + begin, references + end, [&](const TriangleReference & reference) {
+            return std::min((size_t)((reference.getCentroid(k) - minimum) * scale), binCount - 1) < bestBin;
+        }) - references;
+
+        // Erros de arredondamento podem esvaziar um dos lados
+        if (middle == begin || middle == end) {
+            middle = begin + count / 2;
+
+            std::nth_element(references + begin, references + middle, references + end,
+                [k](const TriangleReference & a, const TriangleReference & b) {
+                return a.getCentroid(k) < b.getCentroid(k);
+            });
+        }
+
+        return true;
+    }
+    // Cria nó com caixa e divisão da faixa (retorna falso para folha)
+    bool createNode(size_t begin, size_t end, bool parallel, BoundingVolumeNode & node,
+        size_t & middle) const {
+        Bounds nodeBounds, centroidBounds;
+        computeBounds(begin, end, nodeBounds, centroidBounds, parallel);
+
+        node.minimum = Vector3f(nodeBounds.minimum[0], nodeBounds.minimum[1], nodeBounds.minimum[2]);
+        node.maximum = Vector3f(nodeBounds.maximum[0], nodeBounds.maximum[1], nodeBounds.maximum[2]);
+
+        size_t axis;
+
+        if (!split(begin, end, nodeBounds, centroidBounds, parallel, middle, axis)) {
+            node.offset = (uint32_t)begin;
+            node.count = (uint16_t)(end - begin);
+
+            return false;
+        }
+
+        node.axis = (uint16_t)axis;
+        return true;
+    }
+    // Constrói subárvore sequencialmente em pré-ordem
+    void build(size_t begin, size_t end, std::vector<BoundingVolumeNode> & nodes) const {
+        size_t index = nodes.size();
+        size_t middle;
+
+        nodes.push_back(BoundingVolumeNode());
+
+        if (!createNode(begin, end, false, nodes[index], middle))
+            return;
+
+        build(begin, middle, nodes);
+        nodes[index].offset = (uint32_t)nodes.size();
+        build(middle, end, nodes);
+    }
+    // Constrói níveis superiores até faixas de "subtreeSize" triângulos (registradas como subárvores)
+    size_t buildTop(size_t begin, size_t end, size_t subtreeSize, std::vector<BuildNode> & topNodes,
+        std::vector<std::pair<size_t, size_t>> & subtrees) const {
+        size_t index = topNodes.size();
+        size_t middle;
+
+        topNodes.push_back(BuildNode());
+        topNodes[index].subtree = noSubtree;
+
+        if (end - begin <= subtreeSize) {
+            topNodes[index].subtree = subtrees.size();
+            subtrees.push_back(std::make_pair(begin, end));
+
+            return index;
+        }
+
+        if (!createNode(begin, end, end - begin > parallelRangeSize, topNodes[index].node, middle))
+            return index;
+
+        size_t left = buildTop(begin, middle, subtreeSize, topNodes, subtrees);
+        size_t right = buildTop(middle, end, subtreeSize, topNodes, subtrees);
+
+        topNodes[index].left = left;
+        topNodes[index].right = right;
+
+        return index;
+    }
+};
+
+// Copia níveis superiores e subárvores para a lista final em pré-ordem
+static void flattenNodes(const std::vector<BuildNode> & topNodes, size_t index,
+    const std::vector<std::vector<BoundingVolumeNode>> & subtreeNodes,
+    std::vector<BoundingVolumeNode> & nodes) {
+    const BuildNode & topNode = topNodes[index];
+
+    if (topNode.subtree != noSubtree) {
+        const std::vector<BoundingVolumeNode> & subtree = subtreeNodes[topNode.subtree];
+        uint32_t base = (uint32_t)nodes.size();
+
+        // Filhos à direita são relativos ao início da subárvore
+        for (size_t i = 0; i < subtree.size(); i++) {
+            nodes.push_back(subtree[i]);
+
+            if (!subtree[i].isLeaf())
+                nodes.back().offset += base;
+        }
+
+        return;
+    }
+
+    size_t position = nodes.size();
+    nodes.push_back(topNode.node);
+
+    if (topNode.node.isLeaf())
+        return;
+
+    flattenNodes(topNodes, topNode.left, subtreeNodes, nodes);
+    nodes[position].offset = (uint32_t)nodes.size();
+    flattenNodes(topNodes, topNode.right, subtreeNodes, nodes);
+}
+// Constrói hierarquia a partir das caixas dos triângulos
+static void buildHierarchy(std::vector<TriangleReference> & references, size_t maximumLeafSize,
+    size_t threadCount, std::vector<BoundingVolumeNode> & nodes, std::vector<uint32_t> & triangles) {
+    size_t triangleCount = references.size();
+
+    nodes.clear();
+    triangles.resize(triangleCount);
+
+    if (triangleCount == 0)
+        return;
+
+    if (threadCount == 0)
+        threadCount = threadPool.getThreadCount();
+
+    BoundingVolumeBuilder builder;
+    builder.references = references.data();
+    builder.maximumLeafSize = std::min(std::max(maximumLeafSize, (size_t)1), (size_t)UINT16_MAX);
+    builder.threadCount = threadCount;
+
+    // Níveis superiores são divididos até haver subárvores suficientes para todas as threads
+    size_t subtreeSize = threadCount > 1
+        ? std::max(triangleCount / (threadCount * 4), parallelRangeSize / 8) : triangleCount;
+
+    std::vector<BuildNode> topNodes;
+    std::vector<std::pair<size_t, size_t>> subtrees;
+
+    builder.buildTop(0, triangleCount, subtreeSize, topNodes, subtrees);
+
+    // Folhas têm em média mais de um triângulo (número de nós próximo ao de triângulos)
+    if (topNodes.size() == 1 && subtrees.size() == 1) {
+        nodes.reserve(triangleCount + triangleCount / 4);
+        builder.build(0, triangleCount, nodes);
+    }
+    else {
+        std::vector<std::vector<BoundingVolumeNode>> subtreeNodes(subtrees.size());
+
+        threadPool.run(subtrees.size(), [&](size_t i) {
+            size_t count = subtrees[i].second - subtrees[i].first;
+
+            subtreeNodes[i].reserve(count + count / 4);
+            builder.build(subtrees[i].first, subtrees[i].second, subtreeNodes[i]);
+        }, threadCount);
+
+        size_t nodeCount = topNodes.size();
+
+        for (size_t i = 0; i < subtreeNodes.size(); i++)
+            nodeCount += subtreeNodes[i].size();
+
+        nodes.reserve(nodeCount);
+        flattenNodes(topNodes, 0, subtreeNodes, nodes);
+    }
+
+    threadPool.run(0, triangleCount, parallelRangeSize, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++)
+            triangles[i] = references[i].triangle;
+    }, threadCount);
+}
+
+BoundingVolumeNode::BoundingVolumeNode() : offset(0), count(0), axis(0) {}
+BoundingVolumeNode::~BoundingVolumeNode() {}
+
+bool BoundingVolumeNode::isLeaf() const {
+    return count != 0;
+}
+float BoundingVolumeNode::getSurfaceArea() const {
+    float x = maximum.x - minimum.x, y = maximum.y - minimum.y, z = maximum.z - minimum.z;
+    return 2 * (x * y + y * z + z * x);
+}
+
+BoundingVolumeStatistics::BoundingVolumeStatistics()
+    : cost(0), nodeCount(0), leafCount(0), maximumDepth(0), averageLeafDepth(0), averageLeafSize(0) {}
+BoundingVolumeStatistics::~BoundingVolumeStatistics() {}
+
+std::ostream & operator <<(std::ostream & lhs, const BoundingVolumeStatistics & rhs) {
+    lhs << "SAH cost: " << rhs.cost << std::endl
+        << "Nodes: " << rhs.nodeCount << std::endl
+        << "Leaves: " << rhs.leafCount << std::endl
+        << "Maximum depth: " << rhs.maximumDepth << std::endl
+        << "Average leaf depth: " << rhs.averageLeafDepth << std::endl
+        << "Average leaf size: " << rhs.averageLeafSize << std::endl
+        << "Leaf sizes:";
+
+    for (size_t i = 0; i < rhs.leafSizeHistogram.size(); i++) {
+        if (rhs.leafSizeHistogram[i] != 0)
+            lhs << " " << i << ":" << rhs.leafSizeHistogram[i];
+    }
+
+    return lhs;
+}
+
+BoundingVolumeHierarchy::BoundingVolumeHierarchy() {}
+BoundingVolumeHierarchy::BoundingVolumeHierarchy(const TriangleMesh & triangleMesh, size_t maximumLeafSize,
+    size_t threadCount) {
+    create(triangleMesh, maximumLeafSize, threadCount);
+}
+BoundingVolumeHierarchy::BoundingVolumeHierarchy(const TriangleMeshf & triangleMesh, size_t maximumLeafSize,
+    size_t threadCount) {
+    create(triangleMesh, maximumLeafSize, threadCount);
+}
+BoundingVolumeHierarchy::~BoundingVolumeHierarchy() {}
+
+const std::vector<BoundingVolumeNode> & BoundingVolumeHierarchy::getNodes() const {
+    return nodes;
+}
+const std::vector<uint32_t> & BoundingVolumeHierarchy::getTriangles() const {
+    return triangles;
+}
+const BoundingVolumeNode & BoundingVolumeHierarchy::getNode(size_t i) const {
+    return nodes[i];
+}
+size_t BoundingVolumeHierarchy::getTriangle(size_t i) const {
+    return triangles[i];
+}
+size_t BoundingVolumeHierarchy::getNodeCount() const {
+    return nodes.size();
+}
+size_t BoundingVolumeHierarchy::getMemorySize() const {
+    return nodes.size() * sizeof(BoundingVolumeNode) + triangles.size() * sizeof(uint32_t);
+}
+BoundingVolumeStatistics BoundingVolumeHierarchy::getStatistics() const {
+    BoundingVolumeStatistics statistics;
+
+    if (nodes.empty())
+        return statistics;
+
+    float rootArea = nodes[0].getSurfaceArea();
+    size_t depthSum = 0, triangleSum = 0;
+
+    // Pilha de pares (nó, profundidade)
+    std::vector<std::pair<size_t, size_t>> stack(1, std::make_pair((size_t)0, (size_t)0));
+
+    while (!stack.empty()) {
+        size_t index = stack.back().first, depth = stack.back().second;
+        const BoundingVolumeNode & node = nodes[index];
+
+        stack.pop_back();
+
+        double area = rootArea > 0 ? node.getSurfaceArea() / rootArea : 1;
+
+        statistics.nodeCount++;
+        statistics.maximumDepth = std::max(statistics.maximumDepth, depth);
+
+        if (node.isLeaf()) {
+            statistics.cost += area * node.count;
+            statistics.leafCount++;
+
+            if (statistics.leafSizeHistogram.size() <= node.count)
+                statistics.leafSizeHistogram.resize(node.count + 1, 0);
+
+            statistics.leafSizeHistogram[node.count]++;
+
+            depthSum += depth;
+            triangleSum += node.count;
+        }
+        else {
+            statistics.cost += area;
+
+            stack.push_back(std::make_pair(node.offset, depth + 1));
+            stack.push_back(std::make_pair(index + 1, depth + 1));
+        }
+    }
+
+    statistics.averageLeafDepth = (double)depthSum / statistics.leafCount;
+    statistics.averageLeafSize = (double)triangleSum / statistics.leafCount;
+
+    return statistics;
+}
+bool BoundingVolumeHierarchy::isEmpty() const {
+    return nodes.empty();
+}
+
+BoundingVolumeHierarchy & BoundingVolumeHierarchy::create(const TriangleMesh & triangleMesh,
+    size_t maximumLeafSize, size_t threadCount) {
+    std::vector<TriangleReference> references;
+
+    computeTriangleBounds<TriangleMesh, Vector3>(triangleMesh, references, threadCount);
+    buildHierarchy(references, maximumLeafSize, threadCount, nodes, triangles);
+
+    return *this;
+}
+BoundingVolumeHierarchy & BoundingVolumeHierarchy::create(const TriangleMeshf & triangleMesh,
+    size_t maximumLeafSize, size_t threadCount) {
+    std::vector<TriangleReference> references;
+
+    computeTriangleBounds<TriangleMeshf, Vector3f>(triangleMesh, references, threadCount);
+    buildHierarchy(references, maximumLeafSize, threadCount, nodes, triangles);
+
+    return *this;
+}
+BoundingVolumeHierarchy & BoundingVolumeHierarchy::clear() {
+    nodes.clear();
+    triangles.clear();
+
+    return *this;
+}
@@ -0,0 +1,369 @@
+// File:    Bounds.cpp
+// Author:  Danilo Peixoto
+// Date:    17/10/2026
+
+#include <Bounds.h>
+#include <Matrix.h>
+#include <Thread.h>
+#include <Global.h>
+
+#include <algorithm>
+#include <cmath>
+
+// Instruções SSE2 estão disponíveis em todos processadores x86 de 64 bits
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CGC_SSE2
+#include <emmintrin.h>
+#endif
+
+// Pontos por bloco de trabalho da redução paralela
+static const size_t pointBlockSize = 1 << 16;
+
+// Listas de pontos são percorridas como listas contíguas de componentes
+static_assert(sizeof(Vector3) == 3 * sizeof(double), "Vector3 must be tightly packed");
+static_assert(sizeof(Vector3f) == 3 * sizeof(float), "Vector3f must be tightly packed");
+
+BoundingBox::BoundingBox()
+    : minimum(CGC_INFINITY, CGC_INFINITY, CGC_INFINITY), maximum(-CGC_INFINITY, -CGC_INFINITY, -CGC_INFINITY) {}
+BoundingBox::BoundingBox(const Vector3 & minimum, const Vector3 & maximum) : minimum(minimum), maximum(maximum) {}
+BoundingBox::~BoundingBox() {}
+
+bool BoundingBox::operator ==(const BoundingBox & rhs) const {
+    return minimum == rhs.minimum && maximum == rhs.maximum;
+}
+bool BoundingBox::operator !=(const BoundingBox & rhs) const {
+    return !(*this == rhs);
+}
+std::ostream & operator <<(std::ostream & lhs, const BoundingBox & rhs) {
+    return lhs << '(' << rhs.minimum << ' ' << rhs.maximum << ')';
+}
+
+Vector3 BoundingBox::getCenter() const {
+    return Vector3((minimum.x + maximum.x) * 0.5, (minimum.y + maximum.y) * 0.5, (minimum.z + maximum.z) * 0.5);
+}
+Vector3 BoundingBox::getSize() const {
+    if (isEmpty())
+        return Vector3();
+
+    return Vector3(maximum.x - minimum.x, maximum.y - minimum.y, maximum.z - minimum.z);
+}
+bool BoundingBox::isEmpty() const {
+    return !(minimum.x <= maximum.x && minimum.y <= maximum.y && minimum.z <= maximum.z);
+}
+bool BoundingBox::contains(const Vector3 & point) const {
+    return point.x >= minimum.x && point.x <= maximum.x
+        && point.y >= minimum.y && point.y <= maximum.y
+        && point.z >= minimum.z && point.z <= maximum.z;
+}
+
+BoundingBox & BoundingBox::expand(const Vector3 & point) {
+    minimum.x = std::min(minimum.x, point.x);
+    minimum.y = std::min(minimum.y, point.y);
+    minimum.z = std::min(minimum.z, point.z);
+
+    maximum.x = std::max(maximum.x, point.x);
+    maximum.y = std::max(maximum.y, point.y);
+    maximum.z = std::max(maximum.z, point.z);
+
+    return *this;
+}
+BoundingBox & BoundingBox::expand(const BoundingBox & boundingBox) {
+    minimum.x = std::min(minimum.x, boundingBox.minimum.x);
+    minimum.y = std::min(minimum.y, boundingBox.minimum.y);
+    minimum.z = std::min(minimum.z, boundingBox.minimum.z);
+
+    maximum.x = std::max(maximum.x, boundingBox.maximum.x);
+    maximum.y = std::max(maximum.y, boundingBox.maximum.y);
+    maximum.z = std::max(maximum.z, boundingBox.maximum.z);
+
+    return *this;
+}
+BoundingBox & BoundingBox::transform(const Matrix4 & transformation) {
+    if (isEmpty())
+        return *this;
+
+    // Centro é transformado como ponto e meia extensão pelo valor absoluto da parte linear (Arvo)
+    Vector3 center = getCenter();
+    Vector3 extent = getSize() * 0.5;
+    Vector3 newExtent;
+
+    center *= transformation;
+
+    for (size_t j = 0; j < 3; j++) {
+        newExtent[j] = std::abs(transformation[0][j]) * extent.x
+            + std::abs(transformation[1][j]) * extent.y
+            + std::abs(transformation[2][j]) * extent.z;
+    }
+
+    minimum = center - newExtent;
+    maximum = center + newExtent;
+
+    return *this;
+}
+
+BoundingSphere::BoundingSphere() : radius(-1.0) {}
+BoundingSphere::BoundingSphere(const Vector3 & center, double radius) : center(center), radius(radius) {}
+BoundingSphere::~BoundingSphere() {}
+
+bool BoundingSphere::operator ==(const BoundingSphere & rhs) const {
+    return center == rhs.center && radius == rhs.radius;
+}
+bool BoundingSphere::operator !=(const BoundingSphere & rhs) const {
+    return !(*this == rhs);
+}
+std::ostream & operator <<(std::ostream & lhs, const BoundingSphere & rhs) {
+    return lhs << '(' << rhs.center << ' ' << rhs.radius << ')';
+}
+
+bool BoundingSphere::isEmpty() const {
+    return radius < 0;
+}
+bool BoundingSphere::contains(const Vector3 & point) const {
+    return (point - center).length2() <= radius * radius;
+}
+
+BoundingSphere & BoundingSphere::transform(const Matrix4 & transformation) {
+    if (isEmpty())
+        return *this;
+
+    // Maior escala da parte linear A é a raiz do maior autovalor de A * At, limitado pela maior soma
+    // absoluta das linhas (exato para rotações com escala uniforme)
+    double scale2 = 0;
+
+    for (size_t i = 0; i < 3; i++) {
+        double sum = 0;
+
+        for (size_t j = 0; j < 3; j++) {
+            sum += std::abs(transformation[i][0] * transformation[j][0]
+                + transformation[i][1] * transformation[j][1]
+                + transformation[i][2] * transformation[j][2]);
+        }
+
+        scale2 = std::max(scale2, sum);
+    }
+
+    center *= transformation;
+    radius *= std::sqrt(scale2);
+
+    return *this;
+}
+
+// Amplia caixa com pontos escalares (componentes consecutivas)
+template<typename Real>
+static void expandScalar(const Real * values, size_t count, double * minimum, double * maximum) {
+    for (size_t i = 0; i < count * 3; i += 3) {
+        for (size_t j = 0; j < 3; j++) {
+            minimum[j] = std::min(minimum[j], (double)values[i + j]);
+            maximum[j] = std::max(maximum[j], (double)values[i + j]);
+        }
+    }
+}
+// Retorna maior distância quadrada dos pontos escalares até o centro
+template<typename Real>
+static double distanceScalar(const Real * values, size_t count, const double * center) {
+    double result = 0;
+
+    for (size_t i = 0; i < count * 3; i += 3) {
+        double x = values[i] - center[0], y = values[i + 1] - center[1], z = values[i + 2] - center[2];
+        result = std::max(result, x * x + y * y + z * z);
+    }
+
+    return result;
+}
+
+#ifdef CGC_SSE2
+// Acumuladores de dois pontos intercalados em três registros: (x0 y0), (z0 x1) e (y1 z1)
+struct PointPairBounds {
+    __m128d minimum[3]; // Mínimos por registro
+    __m128d maximum[3]; // Máximos por registro
+
+    PointPairBounds(const double * minimum, const double * maximum) {
+        this->minimum[0] = _mm_set_pd(minimum[1], minimum[0]);
+        this->minimum[1] = _mm_set_pd(minimum[0], minimum[2]);
+        this->minimum[2] = _mm_set_pd(minimum[2], minimum[1]);
+
+        this->maximum[0] = _mm_set_pd(maximum[1], maximum[0]);
+        this->maximum[1] = _mm_set_pd(maximum[0], maximum[2]);
+        this->maximum[2] = _mm_set_pd(maximum[2], maximum[1]);
+    }
+
+    void expand(__m128d a, __m128d b, __m128d c) {
+        minimum[0] = _mm_min_pd(minimum[0], a);
+        minimum[1] = _mm_min_pd(minimum[1], b);
+        minimum[2] = _mm_min_pd(minimum[2], c);
+
+        maximum[0] = _mm_max_pd(maximum[0], a);
+        maximum[1] = _mm_max_pd(maximum[1], b);
+        maximum[2] = _mm_max_pd(maximum[2], c);
+    }
+    // Combina componentes iguais dos registros
+    void store(double * minimum, double * maximum) const {
+        double lower[6], upper[6];
+
+        for (size_t i = 0; i < 3; i++) {
+            _mm_storeu_pd(lower + i * 2, this->minimum[i]);
+            _mm_storeu_pd(upper + i * 2, this->maximum[i]);
+        }
+
+        minimum[0] = std::min(lower[0], lower[3]);
+        minimum[1] = std::min(lower[1], lower[4]);
+        minimum[2] = std::min(lower[2], lower[5]);
+
+        maximum[0] = std::max(upper[0], upper[3]);
+        maximum[1] = std::max(upper[1], upper[4]);
+        maximum[2] = std::max(upper[2], upper[5]);
+    }
+};
+
+// Distâncias quadradas de dois pontos intercalados até o centro (um ponto por valor)
+static inline __m128d distancePair(__m128d a, __m128d b, __m128d c, const __m128d * center) {
+    a = _mm_sub_pd(a, center[0]);
+    b = _mm_sub_pd(b, center[1]);
+    c = _mm_sub_pd(c, center[2]);
+
+    a = _mm_mul_pd(a, a);
+    b = _mm_mul_pd(b, b);
+    c = _mm_mul_pd(c, c);
+
+    // (x0 y1) + (y0 z1) + (z0 x1)
+    return _mm_add_pd(_mm_add_pd(_mm_unpacklo_pd(a, c), _mm_unpackhi_pd(a, c)), b);
+}
+#endif
+
+// Amplia caixa com pontos de precisão dupla
+static void expandPoints(const double * values, size_t count, double * minimum, double * maximum) {
+#ifdef CGC_SSE2
+    PointPairBounds bounds(minimum, maximum);
+    size_t pairCount = count / 2;
+
+    for (size_t i = 0; i < pairCount; i++, values += 6)
+        bounds.expand(_mm_loadu_pd(values), _mm_loadu_pd(values + 2), _mm_loadu_pd(values + 4));
+
+    bounds.store(minimum, maximum);
+    count -= pairCount * 2;
+#endif
+
+    expandScalar(values, count, minimum, maximum);
+}
+// Amplia caixa com pontos de precisão simples
+static void expandPoints(const float * values, size_t count, double * minimum, double * maximum) {
+#ifdef CGC_SSE2
+    // Quatro pontos (três registros de precisão simples) formam dois pares de precisão dupla
+    PointPairBounds bounds(minimum, maximum);
+    size_t quadCount = count / 4;
+
+    for (size_t i = 0; i < quadCount; i++, values += 12) {
+        __m128 a = _mm_loadu_ps(values), b = _mm_loadu_ps(values + 4), c = _mm_loadu_ps(values + 8);
+
+        bounds.expand(_mm_cvtps_pd(a), _mm_cvtps_pd(_mm_movehl_ps(a, a)), _mm_cvtps_pd(b));
+        bounds.expand(_mm_cvtps_pd(_mm_movehl_ps(b, b)), _mm_cvtps_pd(c), _mm_cvtps_pd(_mm_movehl_ps(c, c)));
+    }
+
+    bounds.store(minimum, maximum);
+    count -= quadCount * 4;
+#endif
+
+    expandScalar(values, count, minimum, maximum);
+}
+// Retorna maior distância quadrada dos pontos de precisão dupla até o centro
+static double getMaximumDistance(const double * values, size_t count, const double * center) {
+    double result = 0;
+
+#ifdef CGC_SSE2
+    __m128d offsets[3] = {
+        _mm_set_pd(center[1], center[0]), _mm_set_pd(center[0], center[2]), _mm_set_pd(center[2], center[1])
+    };
+    __m128d distance = _mm_setzero_pd();
+    size_t pairCount = count / 2;
+
+    for (size_t i = 0; i < pairCount; i++, values += 6) {
+        distance = _mm_max_pd(distance,
+            distancePair(_mm_loadu_pd(values), _mm_loadu_pd(values + 2), _mm_loadu_pd(values + 4), offsets));
+    }
+
+    result = std::max(_mm_cvtsd_f64(distance), _mm_cvtsd_f64(_mm_unpackhi_pd(distance, distance)));
+    count -= pairCount * 2;
+#endif
+
+    return std::max(result, distanceScalar(values, count, center));
+}
+// Retorna maior distância quadrada dos pontos de precisão simples até o centro
+static double getMaximumDistance(const float * values, size_t count, const double * center) {
+    double result = 0;
+
+#ifdef CGC_SSE2
+    __m128d offsets[3] = {
+        _mm_set_pd(center[1], center[0]), _mm_set_pd(center[0], center[2]), _mm_set_pd(center[2], center[1])
+    };
+    __m128d distance = _mm_setzero_pd();
+    size_t quadCount = count / 4;
+
+    for (size_t i = 0; i < quadCount; i++, values += 12) {
+        __m128 a = _mm_loadu_ps(values), b = _mm_loadu_ps(values + 4), c = _mm_loadu_ps(values + 8);
+
+        distance = _mm_max_pd(distance,
+            distancePair(_mm_cvtps_pd(a), _mm_cvtps_pd(_mm_movehl_ps(a, a)), _mm_cvtps_pd(b), offsets));
+        distance = _mm_max_pd(distance,
+            distancePair(_mm_cvtps_pd(_mm_movehl_ps(b, b)), _mm_cvtps_pd(c), _mm_cvtps_pd(_mm_movehl_ps(c, c)),
+                offsets));
+    }
+
+    result = std::max(_mm_cvtsd_f64(distance), _mm_cvtsd_f64(_mm_unpackhi_pd(distance, distance)));
+    count -= quadCount * 4;
+#endif
+
+    return std::max(result, distanceScalar(values, count, center));
+}
+
+template<typename Real>
+static void computePointBounds(const Real * values, size_t count, BoundingBox & boundingBox,
+    BoundingSphere & boundingSphere, size_t threadCount) {
+    boundingBox = BoundingBox();
+    boundingSphere = BoundingSphere();
+
+    if (count == 0)
+        return;
+
+    // Resultados parciais por bloco são combinados em ordem fixa (resultado independe das threads)
+    size_t blockCount = (count + pointBlockSize - 1) / pointBlockSize;
+    std::vector<double> minimums(blockCount * 3, CGC_INFINITY), maximums(blockCount * 3, -CGC_INFINITY);
+    std::vector<double> distances(blockCount, 0);
+
+    threadPool.run(blockCount, [&](size_t b) {
+        size_t begin = b * pointBlockSize;
+        size_t end = std::min(begin + pointBlockSize, count);
+
+        expandPoints(values + begin * 3, end - begin, &minimums[b * 3], &maximums[b * 3]);
+    }, threadCount);
+
+    for (size_t b = 0; b < blockCount; b++) {
+        boundingBox.expand(BoundingBox(Vector3(minimums[b * 3], minimums[b * 3 + 1], minimums[b * 3 + 2]),
+            Vector3(maximums[b * 3], maximums[b * 3 + 1], maximums[b * 3 + 2])));
+    }
+
+    // Esfera centrada na caixa tem raio igual à maior distância até o centro
+    Vector3 center = boundingBox.getCenter();
+
+    threadPool.run(blockCount, [&](size_t b) {
+        size_t begin = b * pointBlockSize;
+        size_t end = std::min(begin + pointBlockSize, count);
+
+        distances[b] = getMaximumDistance(values + begin * 3, end - begin, &center.x);
+    }, threadCount);
+
+    double distance = *std::max_element(distances.begin(), distances.end());
+
+    // Raio arredondado para cima garante que o ponto mais distante esteja contido na esfera
+    boundingSphere = BoundingSphere(center, std::nextafter(std::sqrt(distance), CGC_INFINITY));
+}
+
+void computeBounds(const std::vector<Vector3> & points, BoundingBox & boundingBox,
+    BoundingSphere & boundingSphere, size_t threadCount) {
+    computePointBounds(points.empty() ? nullptr : &points[0].x, points.size(), boundingBox, boundingSphere,
+        threadCount);
+}
+void computeBounds(const std::vector<Vector3f> & points, BoundingBox & boundingBox,
+    BoundingSphere & boundingSphere, size_t threadCount) {
+    computePointBounds(points.empty() ? nullptr : &points[0].x, points.size(), boundingBox, boundingSphere,
+        threadCount);
+}
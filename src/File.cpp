@@ -0,0 +1,137 @@
+// File:    File.cpp
+// Author:  Danilo Peixoto
+// Date:    16/10/2026
+
+#include <File.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile() : data(nullptr), size(0), open(false) {
+#ifdef _WIN32
+    file = INVALID_HANDLE_VALUE;
+    mapping = nullptr;
+#else
+    file = -1;
+#endif
+}
+MappedFile::MappedFile(const std::string & filename) : MappedFile() {
+    load(filename);
+}
+MappedFile::~MappedFile() {
+    close();
+}
+
+const char * MappedFile::getData() const {
+    return data;
+}
+size_t MappedFile::getSize() const {
+    return size;
+}
+bool MappedFile::isOpen() const {
+    return open;
+}
+
+bool MappedFile::load(const std::string & filename) {
+    close();
+
+#ifdef _WIN32
+    file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER fileSize;
+
+    if (!GetFileSizeEx(file, &fileSize)) {
+        close();
+        return false;
+    }
+
+    size = (size_t)fileSize.QuadPart;
+
+    // Arquivo vazio não pode ser mapeado
+    if (size != 0) {
+        mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+        if (mapping == nullptr) {
+            close();
+            return false;
+        }
+
+        data = (const char *)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+        if (data == nullptr) {
+            close();
+            return false;
+        }
+    }
+#else
+    file = ::open(filename.c_str(), O_RDONLY);
+
+    if (file == -1)
+        return false;
+
+    struct stat status;
+
+    if (fstat(file, &status) == -1) {
+        close();
+        return false;
+    }
+
+    size = (size_t)status.st_size;
+
+    // Arquivo vazio não pode ser mapeado
+    if (size != 0) {
+        void * address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+
+        if (address == MAP_FAILED) {
+            close();
+            return false;
+        }
+
+        madvise(address, size, MADV_SEQUENTIAL);
+        data = (const char *)address;
+    }
+#endif
+
+    open = true;
+
+    return true;
+}
+MappedFile & MappedFile::close() {
+#ifdef _WIN32
+    if (data != nullptr)
+        UnmapViewOfFile(data);
+
+    if (mapping != nullptr)
+        CloseHandle(mapping);
+
+    if (file != INVALID_HANDLE_VALUE)
+        CloseHandle(file);
+
+    file = INVALID_HANDLE_VALUE;
+    mapping = nullptr;
+#else
+    if (data != nullptr)
+        munmap((void *)data, size);
+
+    if (file != -1)
+        ::close(file);
+
+    file = -1;
+#endif
+
+    data = nullptr;
+    size = 0;
+    open = false;
+
+    return *this;
+}
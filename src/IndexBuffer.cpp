@@ -0,0 +1,263 @@
+// File:    IndexBuffer.cpp
+// Author:  Danilo Peixoto
+// Date:    17/10/2026
+
+#include <IndexBuffer.h>
+
+#include <algorithm>
+#include <utility>
+
+// Converte índices da largura atual para a lista de destino (lista de origem é liberada)
+template<typename T>
+static void convertIndices(std::vector<uint16_t> & indices16, std::vector<uint32_t> & indices32,
+    std::vector<size_t> & indices, size_t width, std::vector<T> & target) {
+    if (width == 2) {
+        target.assign(indices16.begin(), indices16.end());
+        std::vector<uint16_t>().swap(indices16);
+    }
+    else if (width == 4) {
+        target.assign(indices32.begin(), indices32.end());
+        std::vector<uint32_t>().swap(indices32);
+    }
+    else {
+        target.assign(indices.begin(), indices.end());
+        std::vector<size_t>().swap(indices);
+    }
+}
+// Reordena grupos de três índices segundo a ordem de triângulos
+template<typename T>
+static void reorderTriangles(std::vector<T> & indices, const std::vector<size_t> & order) {
+    std::vector<T> result(order.size() * 3);
+
+    for (size_t i = 0; i < order.size(); i++) {
+        const T * triangle = &indices[order[i] * 3];
+
+        result[i * 3] = triangle[0];
+        result[i * 3 + 1] = triangle[1];
+        result[i * 3 + 2] = triangle[2];
+    }
+
+    indices.swap(result);
+}
+// Substitui índices pelas novas posições dos elementos referenciados
+template<typename T>
+static void remapIndices(std::vector<T> & indices, const std::vector<size_t> & remap) {
+    for (size_t i = 0; i < indices.size(); i++)
+        indices[i] = (T)remap[indices[i]];
+}
+// Retorna largura válida mais próxima da solicitada (2, 4 ou "sizeof(size_t)")
+static size_t normalizeWidth(size_t width) {
+    if (width <= 2)
+        return 2;
+
+    if (width <= 4 || sizeof(size_t) <= 4)
+        return 4;
+
+    return sizeof(size_t);
+}
+
+IndexBuffer::IndexBuffer() : width(2) {}
+IndexBuffer::IndexBuffer(size_t size, size_t maximumIndex) : width(getRequiredWidth(maximumIndex)) {
+    resize(size);
+}
+IndexBuffer::IndexBuffer(const std::vector<size_t> & indices) {
+    width = getRequiredWidth(indices.empty() ? 0 : *std::max_element(indices.begin(), indices.end()));
+
+    if (width == 2)
+        indices16.assign(indices.begin(), indices.end());
+    else if (width == 4)
+        indices32.assign(indices.begin(), indices.end());
+    else
+        this->indices = indices;
+}
+IndexBuffer::IndexBuffer(std::vector<size_t> && indices) : width(sizeof(size_t)) {
+    // Largura de 4 bytes é sempre armazenada na lista de 32 bits (inclusive quando "size_t" tem 4 bytes)
+    if (width == 4) {
+        indices32.assign(indices.begin(), indices.end());
+        std::vector<size_t>().swap(indices);
+    }
+    else
+        this->indices = std::move(indices);
+
+    compact();
+}
+IndexBuffer::IndexBuffer(const IndexBuffer & indexBuffer)
+    : width(indexBuffer.width), indices16(indexBuffer.indices16),
+    indices32(indexBuffer.indices32), indices(indexBuffer.indices) {}
+IndexBuffer::IndexBuffer(IndexBuffer && indexBuffer) : width(2) {
+    *this = std::move(indexBuffer);
+}
+IndexBuffer::~IndexBuffer() {}
+
+IndexBuffer & IndexBuffer::operator =(const IndexBuffer & rhs) {
+    width = rhs.width;
+    indices16 = rhs.indices16;
+    indices32 = rhs.indices32;
+    indices = rhs.indices;
+
+    return *this;
+}
+IndexBuffer & IndexBuffer::operator =(IndexBuffer && rhs) {
+    if (this != &rhs) {
+        width = rhs.width;
+        indices16 = std::move(rhs.indices16);
+        indices32 = std::move(rhs.indices32);
+        indices = std::move(rhs.indices);
+
+        rhs.width = 2;
+        rhs.indices16.clear();
+        rhs.indices32.clear();
+        rhs.indices.clear();
+    }
+
+    return *this;
+}
+bool IndexBuffer::operator ==(const IndexBuffer & rhs) const {
+    if (getSize() != rhs.getSize())
+        return false;
+
+    if (width == rhs.width)
+        return indices16 == rhs.indices16 && indices32 == rhs.indices32 && indices == rhs.indices;
+
+    for (size_t i = 0; i < getSize(); i++) {
+        if (get(i) != rhs.get(i))
+            return false;
+    }
+
+    return true;
+}
+bool IndexBuffer::operator !=(const IndexBuffer & rhs) const {
+    return !(*this == rhs);
+}
+
+IndexBuffer & IndexBuffer::set(size_t i, size_t index) {
+    if (width == 2 && index <= UINT16_MAX)
+        indices16[i] = (uint16_t)index;
+    else if (width == 4 && index <= UINT32_MAX)
+        indices32[i] = (uint32_t)index;
+    else if (width == sizeof(size_t) && width != 4)
+        indices[i] = index;
+    else {
+        // Índice não cabe na largura atual
+        setWidth(getRequiredWidth(index));
+        set(i, index);
+    }
+
+    return *this;
+}
+IndexBuffer & IndexBuffer::setWidth(size_t width) {
+    width = normalizeWidth(width);
+
+    // Redução de largura só é possível se todos índices couberem
+    if (width < this->width)
+        width = std::max(width, getRequiredWidth(getMaximum()));
+
+    if (width == this->width)
+        return *this;
+
+    if (width == 2)
+        convertIndices(indices16, indices32, indices, this->width, indices16);
+    else if (width == 4)
+        convertIndices(indices16, indices32, indices, this->width, indices32);
+    else
+        convertIndices(indices16, indices32, indices, this->width, indices);
+
+    this->width = width;
+
+    return *this;
+}
+size_t IndexBuffer::getMemorySize() const {
+    return getSize() * width;
+}
+const void * IndexBuffer::getData() const {
+    if (width == 2)
+        return indices16.data();
+
+    if (width == 4)
+        return indices32.data();
+
+    return indices.data();
+}
+void * IndexBuffer::getData() {
+    if (width == 2)
+        return indices16.data();
+
+    if (width == 4)
+        return indices32.data();
+
+    return indices.data();
+}
+size_t IndexBuffer::getMaximum() const {
+    if (width == 2)
+        return indices16.empty() ? 0 : *std::max_element(indices16.begin(), indices16.end());
+
+    if (width == 4)
+        return indices32.empty() ? 0 : *std::max_element(indices32.begin(), indices32.end());
+
+    return indices.empty() ? 0 : *std::max_element(indices.begin(), indices.end());
+}
+
+IndexBuffer & IndexBuffer::resize(size_t size) {
+    if (width == 2)
+        indices16.resize(size);
+    else if (width == 4)
+        indices32.resize(size);
+    else
+        indices.resize(size);
+
+    return *this;
+}
+IndexBuffer & IndexBuffer::clear() {
+    indices16.clear();
+    indices32.clear();
+    indices.clear();
+
+    return *this;
+}
+IndexBuffer & IndexBuffer::compact() {
+    return setWidth(2);
+}
+IndexBuffer & IndexBuffer::reorderTriangles(const std::vector<size_t> & order) {
+    if (width == 2)
+        ::reorderTriangles(indices16, order);
+    else if (width == 4)
+        ::reorderTriangles(indices32, order);
+    else
+        ::reorderTriangles(indices, order);
+
+    return *this;
+}
+IndexBuffer & IndexBuffer::remap(const std::vector<size_t> & remap) {
+    if (width == 2)
+        remapIndices(indices16, remap);
+    else if (width == 4)
+        remapIndices(indices32, remap);
+    else
+        remapIndices(indices, remap);
+
+    return *this;
+}
+IndexBuffer & IndexBuffer::release(std::vector<size_t> & indices) {
+    if (width == 2)
+        indices.assign(indices16.begin(), indices16.end());
+    else if (width == 4)
+        indices.assign(indices32.begin(), indices32.end());
+    else
+        indices = std::move(this->indices);
+
+    std::vector<uint16_t>().swap(indices16);
+    std::vector<uint32_t>().swap(indices32);
+    std::vector<size_t>().swap(this->indices);
+
+    return *this;
+}
+
+size_t IndexBuffer::getRequiredWidth(size_t maximumIndex) {
+    if (maximumIndex <= UINT16_MAX)
+        return 2;
+
+    if (maximumIndex <= UINT32_MAX)
+        return 4;
+
+    return sizeof(size_t);
+}
@@ -0,0 +1,609 @@
+// File:    MeshAttributes.cpp
+// Author:  Danilo Peixoto
+// Date:    17/10/2026
+
+#include <MeshAttributes.h>
+#include <IndexBuffer.h>
+#include <TriangleMesh.h>
+#include <MeshTopology.h>
+#include <Vector.h>
+#include <Thread.h>
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+// Número de triângulos e vértices processados por tarefa
+static const size_t triangleBlockSize = 1 << 14;
+static const size_t vertexBlockSize = 1 << 12;
+
+// Vetor normal unitário e pesos dos cantos de um triângulo
+template<typename Real>
+struct TriangleNormal {
+    Real normal[3]; // Vetor normal unitário (nulo em triângulo degenerado)
+    Real weights[3]; // Peso de cada canto (ângulo interno ou área do triângulo)
+};
+// Direções unitárias de variação das coordenadas de textura e pesos dos cantos de um triângulo
+template<typename Real>
+struct TriangleTangent {
+    Real tangent[3]; // Direção de crescimento da coordenada "u" (nula sem variação de textura)
+    Real bitangent[3]; // Direção de crescimento da coordenada "v"
+    Real weights[3]; // Ângulo interno de cada canto
+};
+
+// Calcula ângulo interno de cada canto pelas arestas "e0 = p1 - p0", "e1 = p2 - p1" e "e2 = p0 - p2" e pelo
+// dobro da área do triângulo (arco tangente é estável em ângulos pequenos e o terceiro ângulo completa meia volta)
+static void computeCornerAngles(const double * e0, const double * e1, const double * e2, double length,
+    double * angles) {
+    angles[0] = std::atan2(length, -(e2[0] * e0[0] + e2[1] * e0[1] + e2[2] * e0[2]));
+    angles[1] = std::atan2(length, -(e0[0] * e1[0] + e0[1] * e1[1] + e0[2] * e1[2]));
+    angles[2] = std::max(CGC_PI - angles[0] - angles[1], 0.0);
+}
+// Agrupa cantos "3 * t + k" pelo vértice (ordenação por contagem mantém a ordem dos triângulos; cantos do
+// vértice "v" ficam em "corners[offsets[v], offsets[v + 1])")
+static void groupCorners(const IndexBuffer & indices, size_t vertexCount, std::vector<uint32_t> & offsets,
+    std::vector<uint32_t> & corners) {
+    size_t cornerCount = indices.getSize();
+
+    offsets.assign(vertexCount + 1, 0);
+    corners.resize(cornerCount);
+
+    for (size_t c = 0; c < cornerCount; c++)
+        offsets[indices[c] + 1]++;
+
+    for (size_t v = 0; v < vertexCount; v++)
+        offsets[v + 1] += offsets[v];
+
+    for (size_t c = 0; c < cornerCount; c++)
+        corners[offsets[indices[c]]++] = (uint32_t)c;
+
+    for (size_t v = vertexCount; v > 0; v--)
+        offsets[v] = offsets[v - 1];
+
+    offsets[0] = 0;
+}
+
+// Retorna representante do grupo do canto (compressão de caminho pela metade)
+static uint32_t findCorner(std::vector<uint32_t> & parents, uint32_t i) {
+    while (parents[i] != i) {
+        parents[i] = parents[parents[i]];
+        i = parents[i];
+    }
+
+    return i;
+}
+// Verifica se vetor normal do triângulo é nulo (triângulo degenerado)
+template<typename Real>
+static bool isDegenerate(const TriangleNormal<Real> & triangleNormal) {
+    return triangleNormal.normal[0] == 0 && triangleNormal.normal[1] == 0 && triangleNormal.normal[2] == 0;
+}
+// Agrupa cantos de um vértice ligados por arestas com oposta cujos triângulos formam ângulo de até
+// "creaseAngle" (união transitiva ao redor do leque em tempo linear na valência); escreve em "slots" o grupo
+// de cada canto "3 * t + k", numerado na ordem do primeiro canto, e retorna número de grupos
+template<typename Real>
+static size_t groupCreaseCorners(const uint32_t * corners, size_t cornerCount, const MeshTopology & topology,
+    const std::vector<TriangleNormal<Real>> & triangleNormals, double cosine, std::vector<uint32_t> & parents,
+    std::vector<uint32_t> & roots, std::vector<uint32_t> & slots) {
+    parents.resize(cornerCount);
+    roots.resize(cornerCount);
+
+    // Posição local de cada canto é guardada temporariamente no grupo do canto
+    for (size_t i = 0; i < cornerCount; i++) {
+        parents[i] = (uint32_t)i;
+        slots[corners[i]] = (uint32_t)i;
+    }
+
+    for (size_t i = 0; i < cornerCount; i++) {
+        // Semiaresta "3 * t + k" parte do vértice do canto e a próxima da oposta também parte do vértice
+        size_t twin = topology.getTwin(corners[i]);
+
+        if (twin == MeshTopology::none)
+            continue;
+
+        uint32_t j = slots[topology.getNext(twin)];
+
+        const TriangleNormal<Real> & a = triangleNormals[corners[i] / 3];
+        const TriangleNormal<Real> & b = triangleNormals[corners[j] / 3];
+
+        // Triângulo degenerado não tem direção própria e não liga grupos
+        if (isDegenerate(a) || isDegenerate(b))
+            continue;
+
+        if ((double)a.normal[0] * b.normal[0] + (double)a.normal[1] * b.normal[1]
+            + (double)a.normal[2] * b.normal[2] >= cosine)
+            parents[findCorner(parents, (uint32_t)i)] = findCorner(parents, j);
+    }
+
+    for (size_t i = 0; i < cornerCount; i++)
+        roots[i] = findCorner(parents, (uint32_t)i);
+
+    // Lista de pais passa a guardar o grupo de cada representante (cantos degenerados compartilham um grupo
+    // que recebe a soma de todos triângulos)
+    const uint32_t unassigned = UINT32_MAX;
+    uint32_t degenerateSlot = unassigned;
+    size_t slotCount = 0;
+
+    std::fill(parents.begin(), parents.end(), unassigned);
+
+    for (size_t i = 0; i < cornerCount; i++) {
+        uint32_t & slot = isDegenerate(triangleNormals[corners[i] / 3]) ? degenerateSlot : parents[roots[i]];
+
+        if (slot == unassigned)
+            slot = (uint32_t)slotCount++;
+
+        slots[corners[i]] = slot;
+    }
+
+    return slotCount;
+}
+// Soma vetores normais ponderados dos cantos de um vértice no grupo de cada canto ("slots" indexado pelo
+// canto "3 * t + k"; grupo único sem "slots")
+template<typename Real>
+static void sumNormals(const uint32_t * corners, size_t cornerCount, size_t slotCount,
+    const std::vector<TriangleNormal<Real>> & triangleNormals, const uint32_t * slots, std::vector<double> & sums) {
+    sums.assign(slotCount * 3, 0);
+
+    double x = 0, y = 0, z = 0;
+    bool hasDegenerate = false;
+
+    for (size_t i = 0; i < cornerCount; i++) {
+        const TriangleNormal<Real> & a = triangleNormals[corners[i] / 3];
+        double w = a.weights[corners[i] % 3];
+
+        x += w * a.normal[0];
+        y += w * a.normal[1];
+        z += w * a.normal[2];
+
+        if (slots == nullptr)
+            continue;
+
+        if (isDegenerate(a)) {
+            hasDegenerate = true;
+            continue;
+        }
+
+        double * sum = &sums[slots[corners[i]] * 3];
+
+        sum[0] += w * a.normal[0];
+        sum[1] += w * a.normal[1];
+        sum[2] += w * a.normal[2];
+    }
+
+    if (slots == nullptr) {
+        sums[0] = x;
+        sums[1] = y;
+        sums[2] = z;
+
+        return;
+    }
+
+    // Grupo dos cantos degenerados recebe a soma de todos triângulos
+    for (size_t i = 0; hasDegenerate && i < cornerCount; i++) {
+        if (isDegenerate(triangleNormals[corners[i] / 3])) {
+            double * sum = &sums[slots[corners[i]] * 3];
+
+            sum[0] = x;
+            sum[1] = y;
+            sum[2] = z;
+
+            break;
+        }
+    }
+}
+// Gera vetores normais por coleta paralela dos cantos de cada vértice (sem escrita concorrente)
+template<typename Mesh, typename Vector3Type, typename Real>
+static void generateMeshNormals(Mesh * triangleMesh, double creaseAngle, bool angleWeighted,
+    size_t threadCount) {
+    const std::vector<Vector3Type> & vertices = triangleMesh->getVertices();
+    const IndexBuffer & indices = triangleMesh->getVertexIndices();
+    size_t vertexCount = vertices.size();
+    size_t triangleCount = triangleMesh->getTriangleCount();
+    size_t cornerCount = triangleCount * 3;
+
+    // Vetor normal unitário e pesos dos cantos de cada triângulo
+    std::vector<TriangleNormal<Real>> triangleNormals(triangleCount);
+
+    threadPool.run(0, triangleCount, triangleBlockSize, [&](size_t begin, size_t end) {
+        for (size_t t = begin; t < end; t++) {
+            const Vector3Type & p0 = vertices[indices[t * 3]];
+            const Vector3Type & p1 = vertices[indices[t * 3 + 1]];
+            const Vector3Type & p2 = vertices[indices[t * 3 + 2]];
+
+            double e0[3] = {(double)p1.x - p0.x, (double)p1.y - p0.y, (double)p1.z - p0.z};
+            double e1[3] = {(double)p2.x - p1.x, (double)p2.y - p1.y, (double)p2.z - p1.z};
+            double e2[3] = {(double)p0.x - p2.x, (double)p0.y - p2.y, (double)p0.z - p2.z};
+
+            double n[3] = {
+                e2[1] * e0[2] - e2[2] * e0[1],
+                e2[2] * e0[0] - e2[0] * e0[2],
+                e2[0] * e0[1] - e2[1] * e0[0]
+            };
+            double length = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+            double inverseLength = length > 0 ? 1.0 / length : 0;
+
+            TriangleNormal<Real> & a = triangleNormals[t];
+
+            for (size_t k = 0; k < 3; k++)
+                a.normal[k] = (Real)(n[k] * inverseLength);
+
+            if (angleWeighted) {
+                double angles[3];
+
+                computeCornerAngles(e0, e1, e2, length, angles);
+
+                for (size_t k = 0; k < 3; k++)
+                    a.weights[k] = (Real)angles[k];
+            }
+            else
+                a.weights[0] = a.weights[1] = a.weights[2] = (Real)(0.5 * length);
+        }
+    }, threadCount);
+
+    std::vector<uint32_t> offsets, corners;
+
+    groupCorners(indices, vertexCount, offsets, corners);
+
+    // Ângulo de vinco a partir de meia volta suaviza todos triângulos do vértice
+    double cosine = creaseAngle >= CGC_PI ? -2 : std::cos(creaseAngle);
+    bool hasCrease = cosine >= -1;
+
+    // Adjacência entre triângulos e grupo de cada canto são necessários somente com vinco
+    MeshTopology topology;
+    std::vector<uint32_t> slots;
+
+    if (hasCrease) {
+        topology.create(indices, vertexCount);
+        slots.resize(cornerCount);
+    }
+
+    // Primeira passagem agrupa cantos e conta vetores normais distintos de cada vértice (um por vértice
+    // utilizado sem vinco)
+    std::vector<size_t> normalOffsets(vertexCount + 1, 0);
+
+    threadPool.run(0, vertexCount, vertexBlockSize, [&](size_t begin, size_t end) {
+        std::vector<uint32_t> parents, roots;
+
+        for (size_t v = begin; v < end; v++) {
+            size_t count = offsets[v + 1] - offsets[v];
+
+            if (count == 0)
+                continue;
+
+            normalOffsets[v + 1] = hasCrease ? groupCreaseCorners(&corners[offsets[v]], count, topology,
+                triangleNormals, cosine, parents, roots, slots) : 1;
+        }
+    }, threadCount);
+
+    for (size_t v = 0; v < vertexCount; v++)
+        normalOffsets[v + 1] += normalOffsets[v];
+
+    size_t normalCount = normalOffsets[vertexCount];
+
+    // Largura reservada pelo maior índice permite escrita concorrente de índices distintos
+    std::vector<Vector3Type> normals(normalCount);
+    IndexBuffer normalIndices(cornerCount, normalCount == 0 ? 0 : normalCount - 1);
+
+    // Segunda passagem soma os cantos nos grupos da primeira e escreve cada vetor normal na posição
+    // reservada ao vértice
+    threadPool.run(0, vertexCount, vertexBlockSize, [&](size_t begin, size_t end) {
+        std::vector<double> sums;
+
+        for (size_t v = begin; v < end; v++) {
+            size_t count = offsets[v + 1] - offsets[v];
+
+            if (count == 0)
+                continue;
+
+            const uint32_t * vertexCorners = &corners[offsets[v]];
+            size_t vertexNormalCount = normalOffsets[v + 1] - normalOffsets[v];
+
+            sumNormals(vertexCorners, count, vertexNormalCount, triangleNormals,
+                hasCrease ? slots.data() : nullptr, sums);
+
+            for (size_t i = 0; i < vertexNormalCount; i++) {
+                double x = sums[i * 3], y = sums[i * 3 + 1], z = sums[i * 3 + 2];
+                double length = std::sqrt(x * x + y * y + z * z);
+                double inverseLength = length > 0 ? 1.0 / length : 0;
+
+                Vector3Type & normal = normals[normalOffsets[v] + i];
+
+                normal.x = (Real)(x * inverseLength);
+                normal.y = (Real)(y * inverseLength);
+                normal.z = (Real)(z * inverseLength);
+            }
+
+            for (size_t i = 0; i < count; i++)
+                normalIndices.set(vertexCorners[i], normalOffsets[v] + (hasCrease ? slots[vertexCorners[i]] : 0));
+        }
+    }, threadCount);
+
+    triangleMesh->setNormals(std::move(normals), std::move(normalIndices));
+}
+
+// Combina índices de vetor normal e coordenadas de textura de um canto de triângulo
+static size_t hashTangentKey(size_t normalIndex, size_t textureIndex) {
+    uint64_t hash = (uint64_t)normalIndex * UINT64_C(0x9E3779B97F4A7C15);
+
+    hash = (hash ^ textureIndex) * UINT64_C(0xC2B2AE3D27D4EB4F);
+
+    return (size_t)(hash ^ (hash >> 32));
+}
+// Agrupa cantos de um vértice pelo par de índices de vetor normal e coordenadas de textura em tempo linear na
+// valência (tabela de dispersão com endereçamento aberto guarda a posição local do primeiro canto do grupo mais
+// um); escreve em "slots" o grupo de cada canto "3 * t + k", numerado na ordem do primeiro canto, e retorna
+// número de grupos
+static size_t groupTangentCorners(const uint32_t * corners, size_t cornerCount, const IndexBuffer & normalIndices,
+    const IndexBuffer & textureIndices, std::vector<uint32_t> & table, std::vector<uint32_t> & slots) {
+    // Fator de carga limitado a 1/2 mantém sequências de sondagem curtas
+    size_t capacity = 8;
+
+    while (capacity < cornerCount * 2)
+        capacity *= 2;
+
+    table.assign(capacity, 0);
+
+    size_t mask = capacity - 1, slotCount = 0;
+
+    for (size_t i = 0; i < cornerCount; i++) {
+        size_t c = corners[i];
+        size_t n = normalIndices[c], t = textureIndices[c];
+        size_t position = hashTangentKey(n, t) & mask;
+
+        while (true) {
+            uint32_t entry = table[position];
+
+            if (entry == 0) {
+                table[position] = (uint32_t)(i + 1);
+                slots[c] = (uint32_t)slotCount++;
+                break;
+            }
+
+            size_t first = corners[entry - 1];
+
+            if (normalIndices[first] == n && textureIndices[first] == t) {
+                slots[c] = slots[first];
+                break;
+            }
+
+            position = (position + 1) & mask;
+        }
+    }
+
+    return slotCount;
+}
+// Soma direções ponderadas dos cantos de um vértice no grupo de cada canto ("slots" indexado pelo canto
+// "3 * t + k"; somas da tangente e bitangente em "sums" e índice do vetor normal de cada grupo em "keys")
+template<typename Real>
+static void gatherTangents(const uint32_t * corners, size_t cornerCount, size_t slotCount,
+    const std::vector<TriangleTangent<Real>> & triangleTangents, const IndexBuffer & normalIndices,
+    const std::vector<uint32_t> & slots, std::vector<size_t> & keys, std::vector<double> & sums) {
+    keys.resize(slotCount);
+    sums.assign(slotCount * 6, 0);
+
+    for (size_t i = 0; i < cornerCount; i++) {
+        size_t c = corners[i];
+        size_t slot = slots[c];
+
+        const TriangleTangent<Real> & a = triangleTangents[c / 3];
+        double weight = a.weights[c % 3];
+        double * sum = &sums[slot * 6];
+
+        for (size_t k = 0; k < 3; k++) {
+            sum[k] += weight * a.tangent[k];
+            sum[k + 3] += weight * a.bitangent[k];
+        }
+
+        keys[slot] = normalIndices[c];
+    }
+}
+// Ortonormaliza tangente pelo vetor normal (Gram-Schmidt) e calcula bitangente "N x T" com a orientação da
+// bitangente acumulada (direção arbitrária perpendicular à normal se não há variação de textura)
+static void orthonormalizeTangent(const double * normal, const double * sum, double * tangent,
+    double * bitangent) {
+    double length = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+    double inverseLength = length > 0 ? 1.0 / length : 0;
+    double n[3] = {normal[0] * inverseLength, normal[1] * inverseLength, normal[2] * inverseLength};
+
+    double d = n[0] * sum[0] + n[1] * sum[1] + n[2] * sum[2];
+    double t[3] = {sum[0] - n[0] * d, sum[1] - n[1] * d, sum[2] - n[2] * d};
+
+    length = std::sqrt(t[0] * t[0] + t[1] * t[1] + t[2] * t[2]);
+
+    if (length <= CGC_EPSILON * (std::fabs(sum[0]) + std::fabs(sum[1]) + std::fabs(sum[2]))) {
+        // Eixo menos alinhado à normal gera direção perpendicular
+        size_t axis = std::fabs(n[0]) < std::fabs(n[1])
+            ? (std::fabs(n[0]) < std::fabs(n[2]) ? 0 : 2) : (std::fabs(n[1]) < std::fabs(n[2]) ? 1 : 2);
+
+        t[0] = t[1] = t[2] = 0;
+        t[axis] = 1;
+
+        d = n[axis];
+        t[0] -= n[0] * d;
+        t[1] -= n[1] * d;
+        t[2] -= n[2] * d;
+
+        length = std::sqrt(t[0] * t[0] + t[1] * t[1] + t[2] * t[2]);
+    }
+
+    inverseLength = length > 0 ? 1.0 / length : 0;
+
+    for (size_t k = 0; k < 3; k++)
+        tangent[k] = t[k] * inverseLength;
+
+    double b[3] = {
+        n[1] * tangent[2] - n[2] * tangent[1],
+        n[2] * tangent[0] - n[0] * tangent[2],
+        n[0] * tangent[1] - n[1] * tangent[0]
+    };
+
+    // Coordenadas de textura espelhadas invertem a bitangente
+    double sign = b[0] * sum[3] + b[1] * sum[4] + b[2] * sum[5] < 0 ? -1.0 : 1.0;
+
+    for (size_t k = 0; k < 3; k++)
+        bitangent[k] = sign * b[k];
+}
+// Gera vetores tangentes por coleta paralela dos cantos de cada vértice (sem escrita concorrente)
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+static bool generateMeshTangents(Mesh * triangleMesh, size_t threadCount) {
+    if (!triangleMesh->hasNormals() || !triangleMesh->hasTextureCoordinates()) {
+        triangleMesh->clearTangents();
+        return false;
+    }
+
+    const std::vector<Vector3Type> & vertices = triangleMesh->getVertices();
+    const std::vector<Vector3Type> & normals = triangleMesh->getNormals();
+    const std::vector<Vector2Type> & textureCoordinates = triangleMesh->getTextureCoordinates();
+    const IndexBuffer & indices = triangleMesh->getVertexIndices();
+    const IndexBuffer & normalIndices = triangleMesh->getNormalIndices();
+    const IndexBuffer & textureIndices = triangleMesh->getTextureIndices();
+    size_t vertexCount = vertices.size();
+    size_t triangleCount = triangleMesh->getTriangleCount();
+    size_t cornerCount = triangleCount * 3;
+
+    // Direções de crescimento das coordenadas de textura "u" e "v" sobre cada triângulo
+    std::vector<TriangleTangent<Real>> triangleTangents(triangleCount);
+
+    threadPool.run(0, triangleCount, triangleBlockSize, [&](size_t begin, size_t end) {
+        for (size_t t = begin; t < end; t++) {
+            const Vector3Type & p0 = vertices[indices[t * 3]];
+            const Vector3Type & p1 = vertices[indices[t * 3 + 1]];
+            const Vector3Type & p2 = vertices[indices[t * 3 + 2]];
+            const Vector2Type & uv0 = textureCoordinates[textureIndices[t * 3]];
+            const Vector2Type & uv1 = textureCoordinates[textureIndices[t * 3 + 1]];
+            const Vector2Type & uv2 = textureCoordinates[textureIndices[t * 3 + 2]];
+
+            double e0[3] = {(double)p1.x - p0.x, (double)p1.y - p0.y, (double)p1.z - p0.z};
+            double e1[3] = {(double)p2.x - p1.x, (double)p2.y - p1.y, (double)p2.z - p1.z};
+            double e2[3] = {(double)p0.x - p2.x, (double)p0.y - p2.y, (double)p0.z - p2.z};
+
+            double n[3] = {
+                e2[1] * e0[2] - e2[2] * e0[1],
+                e2[2] * e0[0] - e2[0] * e0[2],
+                e2[0] * e0[1] - e2[1] * e0[0]
+            };
+            double length = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+
+            // Sistema "p1 - p0 = du1 T + dv1 B" e "p2 - p0 = du2 T + dv2 B"
+            double du1 = (double)uv1.x - uv0.x, dv1 = (double)uv1.y - uv0.y;
+            double du2 = (double)uv2.x - uv0.x, dv2 = (double)uv2.y - uv0.y;
+            double r = du1 * dv2 - du2 * dv1;
+
+            double tangent[3], bitangent[3];
+
+            for (size_t k = 0; k < 3; k++) {
+                tangent[k] = e0[k] * dv2 + e2[k] * dv1;
+                bitangent[k] = -e2[k] * du1 - e0[k] * du2;
+            }
+
+            // Área orientada negativa no espaço de textura (espelhamento) inverte ambas direções
+            double tangentLength = std::sqrt(tangent[0] * tangent[0] + tangent[1] * tangent[1]
+                + tangent[2] * tangent[2]);
+            double bitangentLength = std::sqrt(bitangent[0] * bitangent[0] + bitangent[1] * bitangent[1]
+                + bitangent[2] * bitangent[2]);
+            double tangentScale = r != 0 && tangentLength > 0 ? (r < 0 ? -1 : 1) / tangentLength : 0;
+            double bitangentScale = r != 0 && bitangentLength > 0 ? (r < 0 ? -1 : 1) / bitangentLength : 0;
+
+            TriangleTangent<Real> & a = triangleTangents[t];
+            double angles[3];
+
+            computeCornerAngles(e0, e1, e2, length, angles);
+
+            for (size_t k = 0; k < 3; k++) {
+                a.tangent[k] = (Real)(tangent[k] * tangentScale);
+                a.bitangent[k] = (Real)(bitangent[k] * bitangentScale);
+                a.weights[k] = (Real)angles[k];
+            }
+        }
+    }, threadCount);
+
+    std::vector<uint32_t> offsets, corners;
+
+    groupCorners(indices, vertexCount, offsets, corners);
+
+    // Primeira passagem agrupa os cantos de cada vértice por pares distintos de vetor normal e coordenadas de
+    // textura (grupo de cada canto é guardado para a segunda passagem)
+    std::vector<size_t> tangentOffsets(vertexCount + 1, 0);
+    std::vector<uint32_t> slots(cornerCount);
+
+    threadPool.run(0, vertexCount, vertexBlockSize, [&](size_t begin, size_t end) {
+        std::vector<uint32_t> table;
+
+        for (size_t v = begin; v < end; v++) {
+            size_t count = offsets[v + 1] - offsets[v];
+
+            if (count != 0)
+                tangentOffsets[v + 1] = groupTangentCorners(&corners[offsets[v]], count, normalIndices,
+                    textureIndices, table, slots);
+        }
+    }, threadCount);
+
+    for (size_t v = 0; v < vertexCount; v++)
+        tangentOffsets[v + 1] += tangentOffsets[v];
+
+    size_t tangentCount = tangentOffsets[vertexCount];
+
+    // Largura reservada pelo maior índice permite escrita concorrente de índices distintos
+    std::vector<Vector3Type> tangents(tangentCount), bitangents(tangentCount);
+    IndexBuffer tangentIndices(cornerCount, tangentCount == 0 ? 0 : tangentCount - 1);
+
+    // Segunda passagem soma as direções de cada grupo e escreve cada vetor tangente na posição reservada ao vértice
+    threadPool.run(0, vertexCount, vertexBlockSize, [&](size_t begin, size_t end) {
+        std::vector<size_t> keys;
+        std::vector<double> sums;
+
+        for (size_t v = begin; v < end; v++) {
+            size_t count = offsets[v + 1] - offsets[v];
+
+            if (count == 0)
+                continue;
+
+            const uint32_t * vertexCorners = &corners[offsets[v]];
+            size_t vertexTangentCount = tangentOffsets[v + 1] - tangentOffsets[v];
+
+            gatherTangents(vertexCorners, count, vertexTangentCount, triangleTangents, normalIndices, slots, keys,
+                sums);
+
+            for (size_t i = 0; i < vertexTangentCount; i++) {
+                const Vector3Type & n = normals[keys[i]];
+                double normal[3] = {n.x, n.y, n.z}, tangent[3], bitangent[3];
+
+                orthonormalizeTangent(normal, &sums[i * 6], tangent, bitangent);
+
+                Vector3Type & t = tangents[tangentOffsets[v] + i];
+                Vector3Type & b = bitangents[tangentOffsets[v] + i];
+
+                t.x = (Real)tangent[0];
+                t.y = (Real)tangent[1];
+                t.z = (Real)tangent[2];
+
+                b.x = (Real)bitangent[0];
+                b.y = (Real)bitangent[1];
+                b.z = (Real)bitangent[2];
+            }
+
+            for (size_t i = 0; i < count; i++)
+                tangentIndices.set(vertexCorners[i], tangentOffsets[v] + slots[vertexCorners[i]]);
+        }
+    }, threadCount);
+
+    triangleMesh->setTangents(std::move(tangents), std::move(bitangents), std::move(tangentIndices));
+
+    return true;
+}
+
+void generateNormals(TriangleMesh * triangleMesh, double creaseAngle, bool angleWeighted, size_t threadCount) {
+    generateMeshNormals<TriangleMesh, Vector3, double>(triangleMesh, creaseAngle, angleWeighted,
+        threadCount);
+}
+void generateNormals(TriangleMeshf * triangleMesh, double creaseAngle, bool angleWeighted, size_t threadCount) {
+    generateMeshNormals<TriangleMeshf, Vector3f, float>(triangleMesh, creaseAngle, angleWeighted,
+        threadCount);
+}
+
+bool generateTangents(TriangleMesh * triangleMesh, size_t threadCount) {
+    return generateMeshTangents<TriangleMesh, Vector3, Vector2, double>(triangleMesh, threadCount);
+}
+bool generateTangents(TriangleMeshf * triangleMesh, size_t threadCount) {
+    return generateMeshTangents<TriangleMeshf, Vector3f, Vector2f, float>(triangleMesh, threadCount);
+}
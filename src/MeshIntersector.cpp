@@ -0,0 +1,980 @@
+// File:    MeshIntersector.cpp
+// Author:  Danilo Peixoto
+// Date:    17/10/2026
+
+#include <MeshIntersector.h>
+#include <TriangleMesh.h>
+#include <Thread.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+
+// Instruções SSE estão disponíveis em todos processadores x86 de 64 bits
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define CGC_SSE
+#include <xmmintrin.h>
+#endif
+
+const size_t RayHit::none = (size_t)-1;
+const size_t PointHit::none = (size_t)-1;
+
+// Pilha de travessia na memória automática cobre hierarquias de até esta profundidade
+static const size_t localStackSize = 128;
+// Grupos de quatro raios por bloco de trabalho das consultas em lote
+static const size_t packetBlockSize = 64;
+// Pontos por bloco de trabalho das consultas de proximidade em lote
+static const size_t pointBlockSize = 256;
+
+// Quatro valores de precisão simples processados simultaneamente (máscaras têm todos bits ligados)
+struct Float4 {
+#ifdef CGC_SSE
+    __m128 value; // Valores
+
+    Float4() {}
+    Float4(__m128 value) : value(value) {}
+    explicit Float4(float x) : value(_mm_set1_ps(x)) {}
+
+    // Carrega quatro valores consecutivos
+    static Float4 load(const float * values) {
+        return _mm_loadu_ps(values);
+    }
+    // Armazena quatro valores consecutivos
+    void store(float * values) const {
+        _mm_storeu_ps(values, value);
+    }
+    // Retorna bits de sinal (um bit por valor)
+    int getMask() const {
+        return _mm_movemask_ps(value);
+    }
+
+    Float4 operator +(const Float4 & rhs) const { return _mm_add_ps(value, rhs.value); }
+    Float4 operator -(const Float4 & rhs) const { return _mm_sub_ps(value, rhs.value); }
+    Float4 operator *(const Float4 & rhs) const { return _mm_mul_ps(value, rhs.value); }
+    Float4 operator /(const Float4 & rhs) const { return _mm_div_ps(value, rhs.value); }
+    Float4 operator <(const Float4 & rhs) const { return _mm_cmplt_ps(value, rhs.value); }
+    Float4 operator <=(const Float4 & rhs) const { return _mm_cmple_ps(value, rhs.value); }
+    Float4 operator >=(const Float4 & rhs) const { return _mm_cmpge_ps(value, rhs.value); }
+    Float4 operator !=(const Float4 & rhs) const { return _mm_cmpneq_ps(value, rhs.value); }
+    Float4 operator &(const Float4 & rhs) const { return _mm_and_ps(value, rhs.value); }
+
+    // Retorna menor valor de cada posição
+    static Float4 minimum(const Float4 & a, const Float4 & b) {
+        return _mm_min_ps(a.value, b.value);
+    }
+    // Retorna maior valor de cada posição
+    static Float4 maximum(const Float4 & a, const Float4 & b) {
+        return _mm_max_ps(a.value, b.value);
+    }
+    // Retorna "a" nas posições da máscara e "b" nas demais
+    static Float4 select(const Float4 & mask, const Float4 & a, const Float4 & b) {
+        return _mm_or_ps(_mm_and_ps(mask.value, a.value), _mm_andnot_ps(mask.value, b.value));
+    }
+#else
+    float value[4]; // Valores
+
+    Float4() {}
+    explicit Float4(float x) {
+        value[0] = value[1] = value[2] = value[3] = x;
+    }
+
+    // Converte estado lógico em máscara
+    static float toMask(bool state) {
+        uint32_t bits = state ? 0xFFFFFFFF : 0;
+        float mask;
+
+        std::memcpy(&mask, &bits, sizeof(float));
+        return mask;
+    }
+    // Retorna bits do valor
+    static uint32_t toBits(float x) {
+        uint32_t bits;
+
+        std::memcpy(&bits, &x, sizeof(float));
+        return bits;
+    }
+
+    // Carrega quatro valores consecutivos
+    static Float4 load(const float * values) {
+        Float4 result;
+        std::memcpy(result.value, values, sizeof(result.value));
+
+        return result;
+    }
+    // Armazena quatro valores consecutivos
+    void store(float * values) const {
+        std::memcpy(values, value, sizeof(value));
+    }
+    // Retorna bits de sinal (um bit por valor)
+    int getMask() const {
+        int mask = 0;
+
+        for (size_t i = 0; i < 4; i++)
+            mask |= (int)(toBits(value[i]) >> 31) << i;
+
+        return mask;
+    }
+
+#define CGC_FLOAT4_OPERATOR(operation, expression) \
+    Float4 operator operation(const Float4 & rhs) const { \
+        Float4 result; \
+        for (size_t i = 0; i < 4; i++) \
+            result.value[i] = expression; \
+        return result; \
+    }
+
+    CGC_FLOAT4_OPERATOR(+, value[i] + rhs.value[i])
+    CGC_FLOAT4_OPERATOR(-, value[i] - rhs.value[i])
+    CGC_FLOAT4_OPERATOR(*, value[i] * rhs.value[i])
+    CGC_FLOAT4_OPERATOR(/, value[i] / rhs.value[i])
+    CGC_FLOAT4_OPERATOR(<, toMask(value[i] < rhs.value[i]))
+    CGC_FLOAT4_OPERATOR(<=, toMask(value[i] <= rhs.value[i]))
+    CGC_FLOAT4_OPERATOR(>=, toMask(value[i] >= rhs.value[i]))
+    CGC_FLOAT4_OPERATOR(!=, toMask(value[i] != rhs.value[i]))
+    CGC_FLOAT4_OPERATOR(&, toMask(toBits(value[i]) & toBits(rhs.value[i])))
+
+#undef CGC_FLOAT4_OPERATOR
+
+    // Retorna menor valor de cada posição
+    static Float4 minimum(const Float4 & a, const Float4 & b) {
+        Float4 result;
+
+        for (size_t i = 0; i < 4; i++)
+            result.value[i] = a.value[i] < b.value[i] ? a.value[i] : b.value[i];
+
+        return result;
+    }
+    // Retorna maior valor de cada posição
+    static Float4 maximum(const Float4 & a, const Float4 & b) {
+        Float4 result;
+
+        for (size_t i = 0; i < 4; i++)
+            result.value[i] = a.value[i] > b.value[i] ? a.value[i] : b.value[i];
+
+        return result;
+    }
+    // Retorna "a" nas posições da máscara e "b" nas demais
+    static Float4 select(const Float4 & mask, const Float4 & a, const Float4 & b) {
+        Float4 result;
+
+        for (size_t i = 0; i < 4; i++)
+            result.value[i] = toBits(mask.value[i]) ? a.value[i] : b.value[i];
+
+        return result;
+    }
+#endif
+};
+
+// Testa quatro pares de raio e triângulo simultaneamente (Möller-Trumbore) e retorna máscara das
+// interseções com distância em [minimum, maximum)
+static Float4 intersectTriangles(const Float4 * vertex, const Float4 * edge1, const Float4 * edge2,
+    const Float4 * origin, const Float4 * direction, const Float4 & minimum, const Float4 & maximum,
+    Float4 & distance, Float4 & u, Float4 & v) {
+    Float4 px = direction[1] * edge2[2] - direction[2] * edge2[1];
+    Float4 py = direction[2] * edge2[0] - direction[0] * edge2[2];
+    Float4 pz = direction[0] * edge2[1] - direction[1] * edge2[0];
+
+    Float4 determinant = edge1[0] * px + edge1[1] * py + edge1[2] * pz;
+    Float4 inverse = Float4(1) / determinant;
+
+    Float4 tx = origin[0] - vertex[0];
+    Float4 ty = origin[1] - vertex[1];
+    Float4 tz = origin[2] - vertex[2];
+
+    u = (tx * px + ty * py + tz * pz) * inverse;
+
+    Float4 qx = ty * edge1[2] - tz * edge1[1];
+    Float4 qy = tz * edge1[0] - tx * edge1[2];
+    Float4 qz = tx * edge1[1] - ty * edge1[0];
+
+    v = (direction[0] * qx + direction[1] * qy + direction[2] * qz) * inverse;
+    distance = (edge2[0] * qx + edge2[1] * qy + edge2[2] * qz) * inverse;
+
+    Float4 zero(0);
+
+    // Triângulos degenerados (e posições vazias dos grupos) têm determinante nulo
+    return (determinant != zero) & (u >= zero) & (v >= zero) & (u + v <= Float4(1))
+        & (distance >= minimum) & (distance < maximum);
+}
+// Inverso da componente da direção (componentes nulas são substituídas por valores minúsculos)
+static float invert(float x) {
+    const float epsilon = 1e-20f;
+    return 1 / (std::fabs(x) > epsilon ? x : (x < 0 ? -epsilon : epsilon));
+}
+// Retorna quadrado das distâncias entre pontos relativos ao primeiro vértice e pontos de coordenadas (u, v)
+static Float4 getSquaredDistance(const Float4 * edge1, const Float4 * edge2,
+    const Float4 & ax, const Float4 & ay, const Float4 & az, const Float4 & u, const Float4 & v) {
+    Float4 dx = edge1[0] * u + edge2[0] * v - ax;
+    Float4 dy = edge1[1] * u + edge2[1] * v - ay;
+    Float4 dz = edge1[2] * u + edge2[2] * v - az;
+
+    return dx * dx + dy * dy + dz * dz;
+}
+// Calcula pontos mais próximos de quatro triângulos simultaneamente pela região de Voronoi do ponto
+// (Ericson) e retorna quadrado das distâncias
+static Float4 getClosestPoints(const Float4 * vertex, const Float4 * edge1, const Float4 * edge2,
+    const Float4 * point, Float4 & u, Float4 & v) {
+    Float4 zero(0), one(1);
+
+    Float4 ax = point[0] - vertex[0];
+    Float4 ay = point[1] - vertex[1];
+    Float4 az = point[2] - vertex[2];
+
+    Float4 d1 = edge1[0] * ax + edge1[1] * ay + edge1[2] * az;
+    Float4 d2 = edge2[0] * ax + edge2[1] * ay + edge2[2] * az;
+
+    Float4 bx = ax - edge1[0];
+    Float4 by = ay - edge1[1];
+    Float4 bz = az - edge1[2];
+
+    Float4 d3 = edge1[0] * bx + edge1[1] * by + edge1[2] * bz;
+    Float4 d4 = edge2[0] * bx + edge2[1] * by + edge2[2] * bz;
+
+    Float4 cx = ax - edge2[0];
+    Float4 cy = ay - edge2[1];
+    Float4 cz = az - edge2[2];
+
+    Float4 d5 = edge1[0] * cx + edge1[1] * cy + edge1[2] * cz;
+    Float4 d6 = edge2[0] * cx + edge2[1] * cy + edge2[2] * cz;
+
+    Float4 va = d3 * d6 - d5 * d4;
+    Float4 vb = d5 * d2 - d1 * d6;
+    Float4 vc = d1 * d4 - d3 * d2;
+
+    // Regiões são aplicadas da menor para a maior prioridade (interior, arestas e vértices). Arestas de
+    // comprimento nulo (triângulos degenerados) são ignoradas para não produzir coordenadas indefinidas
+    Float4 inverse = one / (va + vb + vc);
+
+    u = vb * inverse;
+    v = vc * inverse;
+
+    Float4 d43 = d4 - d3, d56 = d5 - d6;
+    Float4 mask = (va <= zero) & (d43 >= zero) & (d56 >= zero) & (zero < d43 + d56);
+    Float4 w = d43 / (d43 + d56);
+
+    u = Float4::select(mask, one - w, u);
+    v = Float4::select(mask, w, v);
+
+    mask = (vb <= zero) & (d2 >= zero) & (d6 <= zero) & (zero < d2 - d6);
+    u = Float4::select(mask, zero, u);
+    v = Float4::select(mask, d2 / (d2 - d6), v);
+
+    mask = (d6 >= zero) & (d5 <= d6);
+    u = Float4::select(mask, zero, u);
+    v = Float4::select(mask, one, v);
+
+    mask = (vc <= zero) & (d1 >= zero) & (d3 <= zero) & (zero < d1 - d3);
+    u = Float4::select(mask, d1 / (d1 - d3), u);
+    v = Float4::select(mask, zero, v);
+
+    mask = (d3 >= zero) & (d4 <= d3);
+    u = Float4::select(mask, one, u);
+    v = Float4::select(mask, zero, v);
+
+    mask = (d1 <= zero) & (d2 <= zero);
+    u = Float4::select(mask, zero, u);
+    v = Float4::select(mask, zero, v);
+
+    Float4 distance = getSquaredDistance(edge1, edge2, ax, ay, az, u, v);
+
+    // Em triângulos quase degenerados, erros de arredondamento em va, vb e vc escolhem regiões erradas (inclusive
+    // a interior com coordenadas fora do triângulo). Nesses casos prevalece o ponto mais próximo das três arestas
+    Float4 inside = (zero <= u) & (zero <= v) & (u + v <= one);
+    Float4 thin = va + vb + vc <= Float4(1e-4f) * (d1 - d3) * (d2 - d6);
+
+    if ((inside.getMask() & ~thin.getMask()) != 0xF) {
+        // Coordenadas ao longo de arestas de comprimento nulo são indefinidas e substituídas por zero
+        Float4 t = Float4::minimum(Float4::maximum(d1 / (d1 - d3), zero), one);
+        Float4 edgeU = t, edgeV = zero;
+        Float4 edgeDistance = getSquaredDistance(edge1, edge2, ax, ay, az, t, zero);
+
+        t = Float4::minimum(Float4::maximum(d2 / (d2 - d6), zero), one);
+        Float4 candidate = getSquaredDistance(edge1, edge2, ax, ay, az, zero, t);
+        mask = candidate < edgeDistance;
+
+        edgeU = Float4::select(mask, zero, edgeU);
+        edgeV = Float4::select(mask, t, edgeV);
+        edgeDistance = Float4::select(mask, candidate, edgeDistance);
+
+        t = Float4::minimum(Float4::maximum(d43 / (d43 + d56), zero), one);
+        candidate = getSquaredDistance(edge1, edge2, ax, ay, az, one - t, t);
+        mask = candidate < edgeDistance;
+
+        edgeU = Float4::select(mask, one - t, edgeU);
+        edgeV = Float4::select(mask, t, edgeV);
+        edgeDistance = Float4::select(mask, candidate, edgeDistance);
+
+        mask = inside & (distance <= edgeDistance);
+
+        u = Float4::select(mask, u, edgeU);
+        v = Float4::select(mask, v, edgeV);
+        distance = Float4::select(mask, distance, edgeDistance);
+    }
+
+    return distance;
+}
+// Retorna quadrado da distância do ponto à caixa envolvente do nó
+static float getSquaredDistance(const BoundingVolumeNode & node, const float * point) {
+    float dx = std::max(std::max(node.minimum.x - point[0], point[0] - node.maximum.x), 0.0f);
+    float dy = std::max(std::max(node.minimum.y - point[1], point[1] - node.maximum.y), 0.0f);
+    float dz = std::max(std::max(node.minimum.z - point[2], point[2] - node.maximum.z), 0.0f);
+
+    return dx * dx + dy * dy + dz * dz;
+}
+
+// Pilha de travessia (memória automática para hierarquias rasas)
+class TraversalStack {
+private:
+    uint32_t localNodes[localStackSize]; // Nós pendentes na memória automática
+    std::vector<uint32_t> heapNodes; // Nós pendentes para hierarquias profundas
+    uint32_t * nodes; // Nós pendentes
+    size_t size; // Número de nós pendentes
+
+public:
+    TraversalStack(size_t depth) : size(0) {
+        if (depth < localStackSize)
+            nodes = localNodes;
+        else {
+            heapNodes.resize(depth + 1);
+            nodes = heapNodes.data();
+        }
+    }
+
+    void push(uint32_t node) {
+        nodes[size++] = node;
+    }
+    uint32_t pop() {
+        return nodes[--size];
+    }
+    bool isEmpty() const {
+        return size == 0;
+    }
+};
+
+// Percorre hierarquia com um único raio (testes de triângulos em grupos de quatro)
+static bool traverseRay(const BoundingVolumeNode * nodes, const TrianglePacket * packets, size_t depth,
+    const Ray & ray, bool anyHit, RayHit & hit) {
+    float origin[3] = {ray.origin.x, ray.origin.y, ray.origin.z};
+    float direction[3] = {ray.direction.x, ray.direction.y, ray.direction.z};
+    float inverse[3] = {invert(direction[0]), invert(direction[1]), invert(direction[2])};
+
+    Float4 origin4[3] = {Float4(origin[0]), Float4(origin[1]), Float4(origin[2])};
+    Float4 direction4[3] = {Float4(direction[0]), Float4(direction[1]), Float4(direction[2])};
+    Float4 minimum4(ray.minimumDistance);
+
+    float maximum = ray.maximumDistance;
+    bool isHit = false;
+
+    TraversalStack stack(depth);
+    uint32_t index = 0;
+
+    while (true) {
+        const BoundingVolumeNode & node = nodes[index];
+
+        // Teste de caixa pelo método das placas
+        float nearDistance = ray.minimumDistance, farDistance = maximum;
+        float t0, t1;
+
+        t0 = (node.minimum.x - origin[0]) * inverse[0];
+        t1 = (node.maximum.x - origin[0]) * inverse[0];
+        nearDistance = std::max(nearDistance, std::min(t0, t1));
+        farDistance = std::min(farDistance, std::max(t0, t1));
+
+        t0 = (node.minimum.y - origin[1]) * inverse[1];
+        t1 = (node.maximum.y - origin[1]) * inverse[1];
+        nearDistance = std::max(nearDistance, std::min(t0, t1));
+        farDistance = std::min(farDistance, std::max(t0, t1));
+
+        t0 = (node.minimum.z - origin[2]) * inverse[2];
+        t1 = (node.maximum.z - origin[2]) * inverse[2];
+        nearDistance = std::max(nearDistance, std::min(t0, t1));
+        farDistance = std::min(farDistance, std::max(t0, t1));
+
+        if (nearDistance <= farDistance) {
+            if (!node.isLeaf()) {
+                // Filho mais próximo da origem é visitado primeiro
+                if (direction[node.axis] < 0) {
+                    stack.push(index + 1);
+                    index = node.offset;
+                }
+                else {
+                    stack.push(node.offset);
+                    index++;
+                }
+
+                continue;
+            }
+
+            size_t packetEnd = node.offset + (node.count + 3) / 4;
+
+            for (size_t i = node.offset; i < packetEnd; i++) {
+                const TrianglePacket & packet = packets[i];
+
+                Float4 vertex[3] = {Float4::load(packet.vertex[0]), Float4::load(packet.vertex[1]),
+                    Float4::load(packet.vertex[2])};
+                Float4 edge1[3] = {Float4::load(packet.edge1[0]), Float4::load(packet.edge1[1]),
+                    Float4::load(packet.edge1[2])};
+                Float4 edge2[3] = {Float4::load(packet.edge2[0]), Float4::load(packet.edge2[1]),
+                    Float4::load(packet.edge2[2])};
+
+                Float4 distance, u, v;
+                int mask = intersectTriangles(vertex, edge1, edge2, origin4, direction4, minimum4,
+                    Float4(maximum), distance, u, v).getMask();
+
+                if (mask == 0)
+                    continue;
+
+                if (anyHit)
+                    return true;
+
+                float distances[4], us[4], vs[4];
+
+                distance.store(distances);
+                u.store(us);
+                v.store(vs);
+
+                for (size_t j = 0; j < 4; j++) {
+                    if ((mask >> j & 1) && distances[j] < maximum) {
+                        maximum = distances[j];
+
+                        hit.triangle = packet.triangles[j];
+                        hit.u = us[j];
+                        hit.v = vs[j];
+                        hit.distance = distances[j];
+                    }
+                }
+
+                isHit = true;
+            }
+        }
+
+        if (stack.isEmpty())
+            break;
+
+        index = stack.pop();
+    }
+
+    return isHit;
+}
+// Percorre hierarquia com até quatro raios simultâneos (grupo segue enquanto algum raio atinge o nó)
+static size_t traversePacket(const BoundingVolumeNode * nodes, const TrianglePacket * packets, size_t depth,
+    const Ray * rays, size_t count, bool anyHit, RayHit * hits, bool * results) {
+    float values[8][4];
+
+    // Posições vazias repetem o primeiro raio e permanecem inativas
+    for (size_t i = 0; i < 4; i++) {
+        const Ray & ray = rays[i < count ? i : 0];
+
+        values[0][i] = ray.origin.x;
+        values[1][i] = ray.origin.y;
+        values[2][i] = ray.origin.z;
+        values[3][i] = ray.direction.x;
+        values[4][i] = ray.direction.y;
+        values[5][i] = ray.direction.z;
+        values[6][i] = ray.minimumDistance;
+        values[7][i] = ray.maximumDistance;
+    }
+
+    Float4 origin[3], direction[3], inverse[3];
+
+    for (size_t k = 0; k < 3; k++) {
+        float inverses[4] = {invert(values[k + 3][0]), invert(values[k + 3][1]),
+            invert(values[k + 3][2]), invert(values[k + 3][3])};
+
+        origin[k] = Float4::load(values[k]);
+        direction[k] = Float4::load(values[k + 3]);
+        inverse[k] = Float4::load(inverses);
+    }
+
+    Float4 minimum = Float4::load(values[6]);
+    Float4 maximum = Float4::load(values[7]);
+    Float4 hitU(0), hitV(0);
+
+    size_t hitTriangles[4] = {RayHit::none, RayHit::none, RayHit::none, RayHit::none};
+    int active = (1 << count) - 1;
+    int hitMask = 0;
+
+    TraversalStack stack(depth);
+    uint32_t index = 0;
+
+    while (true) {
+        const BoundingVolumeNode & node = nodes[index];
+
+        // Teste de caixa pelo método das placas para os quatro raios
+        Float4 nearDistance = minimum, farDistance = maximum;
+        Float4 t0, t1;
+
+        t0 = (Float4(node.minimum.x) - origin[0]) * inverse[0];
+        t1 = (Float4(node.maximum.x) - origin[0]) * inverse[0];
+        nearDistance = Float4::maximum(nearDistance, Float4::minimum(t0, t1));
+        farDistance = Float4::minimum(farDistance, Float4::maximum(t0, t1));
+
+        t0 = (Float4(node.minimum.y) - origin[1]) * inverse[1];
+        t1 = (Float4(node.maximum.y) - origin[1]) * inverse[1];
+        nearDistance = Float4::maximum(nearDistance, Float4::minimum(t0, t1));
+        farDistance = Float4::minimum(farDistance, Float4::maximum(t0, t1));
+
+        t0 = (Float4(node.minimum.z) - origin[2]) * inverse[2];
+        t1 = (Float4(node.maximum.z) - origin[2]) * inverse[2];
+        nearDistance = Float4::maximum(nearDistance, Float4::minimum(t0, t1));
+        farDistance = Float4::minimum(farDistance, Float4::maximum(t0, t1));
+
+        int mask = (nearDistance <= farDistance).getMask() & active;
+
+        if (mask != 0) {
+            if (!node.isLeaf()) {
+                // Ordem de visita pelo sentido do primeiro raio que atinge o nó
+                size_t lane = 0;
+
+                while (!(mask >> lane & 1))
+                    lane++;
+
+                if (values[node.axis + 3][lane] < 0) {
+                    stack.push(index + 1);
+                    index = node.offset;
+                }
+                else {
+                    stack.push(node.offset);
+                    index++;
+                }
+
+                continue;
+            }
+
+            for (size_t i = 0; i < node.count; i++) {
+                const TrianglePacket & packet = packets[node.offset + i / 4];
+                size_t j = i % 4;
+
+                Float4 vertex[3] = {Float4(packet.vertex[0][j]), Float4(packet.vertex[1][j]),
+                    Float4(packet.vertex[2][j])};
+                Float4 edge1[3] = {Float4(packet.edge1[0][j]), Float4(packet.edge1[1][j]),
+                    Float4(packet.edge1[2][j])};
+                Float4 edge2[3] = {Float4(packet.edge2[0][j]), Float4(packet.edge2[1][j]),
+                    Float4(packet.edge2[2][j])};
+
+                Float4 distance, u, v;
+                Float4 triangleMask = intersectTriangles(vertex, edge1, edge2, origin, direction,
+                    minimum, maximum, distance, u, v);
+                int triangleHits = triangleMask.getMask() & active;
+
+                if (triangleHits == 0)
+                    continue;
+
+                hitMask |= triangleHits;
+
+                // Raios obstruídos deixam o grupo
+                if (anyHit) {
+                    active &= ~triangleHits;
+
+                    if (active == 0)
+                        break;
+
+                    continue;
+                }
+
+                maximum = Float4::select(triangleMask, distance, maximum);
+                hitU = Float4::select(triangleMask, u, hitU);
+                hitV = Float4::select(triangleMask, v, hitV);
+
+                for (size_t lane = 0; lane < 4; lane++) {
+                    if (triangleHits >> lane & 1)
+                        hitTriangles[lane] = packet.triangles[j];
+                }
+            }
+
+            if (active == 0)
+                break;
+        }
+
+        if (stack.isEmpty())
+            break;
+
+        index = stack.pop();
+    }
+
+    size_t hitCount = 0;
+
+    if (anyHit) {
+        for (size_t i = 0; i < count; i++) {
+            results[i] = (hitMask >> i & 1) != 0;
+            hitCount += results[i];
+        }
+
+        return hitCount;
+    }
+
+    float distances[4], us[4], vs[4];
+
+    maximum.store(distances);
+    hitU.store(us);
+    hitV.store(vs);
+
+    for (size_t i = 0; i < count; i++) {
+        RayHit & hit = hits[i];
+
+        // Raio sem interseção recebe resultado padrão (como na consulta de raio único)
+        if (hitTriangles[i] == RayHit::none) {
+            hit = RayHit();
+            continue;
+        }
+
+        hit.triangle = hitTriangles[i];
+        hit.u = us[i];
+        hit.v = vs[i];
+        hit.distance = distances[i];
+
+        hitCount++;
+    }
+
+    return hitCount;
+}
+// Percorre hierarquia em ordem de proximidade descartando nós mais distantes que o melhor resultado
+static bool traversePoint(const BoundingVolumeNode * nodes, const TrianglePacket * packets, size_t depth,
+    const Vector3f & point, float maximumDistance, PointHit & hit) {
+    float position[3] = {point.x, point.y, point.z};
+    Float4 position4[3] = {Float4(position[0]), Float4(position[1]), Float4(position[2])};
+
+    float best = maximumDistance * maximumDistance;
+    const TrianglePacket * bestPacket = nullptr;
+    size_t bestLane = 0;
+
+    TraversalStack stack(depth);
+    uint32_t index = 0;
+
+    if (getSquaredDistance(nodes[0], position) < best) {
+        while (true) {
+            const BoundingVolumeNode & node = nodes[index];
+
+            if (!node.isLeaf()) {
+                // Filho mais próximo é visitado primeiro e o outro aguarda na pilha
+                uint32_t nearChild = index + 1, farChild = node.offset;
+                float nearDistance = getSquaredDistance(nodes[nearChild], position);
+                float farDistance = getSquaredDistance(nodes[farChild], position);
+
+                if (farDistance < nearDistance) {
+                    std::swap(nearChild, farChild);
+                    std::swap(nearDistance, farDistance);
+                }
+
+                if (nearDistance < best) {
+                    if (farDistance < best)
+                        stack.push(farChild);
+
+                    index = nearChild;
+                    continue;
+                }
+            }
+            else {
+                size_t packetEnd = node.offset + (node.count + 3) / 4;
+
+                for (size_t i = node.offset; i < packetEnd; i++) {
+                    const TrianglePacket & packet = packets[i];
+
+                    Float4 vertex[3] = {Float4::load(packet.vertex[0]), Float4::load(packet.vertex[1]),
+                        Float4::load(packet.vertex[2])};
+                    Float4 edge1[3] = {Float4::load(packet.edge1[0]), Float4::load(packet.edge1[1]),
+                        Float4::load(packet.edge1[2])};
+                    Float4 edge2[3] = {Float4::load(packet.edge2[0]), Float4::load(packet.edge2[1]),
+                        Float4::load(packet.edge2[2])};
+
+                    Float4 u, v;
+                    float distances[4], us[4], vs[4];
+
+                    getClosestPoints(vertex, edge1, edge2, position4, u, v).store(distances);
+                    u.store(us);
+                    v.store(vs);
+
+                    // Posições vazias do último grupo são ignoradas
+                    size_t laneCount = std::min((size_t)node.count - (i - node.offset) * 4, (size_t)4);
+
+                    for (size_t j = 0; j < laneCount; j++) {
+                        if (distances[j] < best) {
+                            best = distances[j];
+
+                            hit.triangle = packet.triangles[j];
+                            hit.u = us[j];
+                            hit.v = vs[j];
+
+                            bestPacket = &packet;
+                            bestLane = j;
+                        }
+                    }
+                }
+            }
+
+            // Nós pendentes podem ter sido descartados por resultados encontrados após a inserção
+            index = (uint32_t)-1;
+
+            while (!stack.isEmpty()) {
+                uint32_t candidate = stack.pop();
+
+                if (getSquaredDistance(nodes[candidate], position) < best) {
+                    index = candidate;
+                    break;
+                }
+            }
+
+            if (index == (uint32_t)-1)
+                break;
+        }
+    }
+
+    if (bestPacket == nullptr)
+        return false;
+
+    float closest[3];
+
+    for (size_t k = 0; k < 3; k++) {
+        closest[k] = bestPacket->vertex[k][bestLane] + bestPacket->edge1[k][bestLane] * hit.u
+            + bestPacket->edge2[k][bestLane] * hit.v;
+    }
+
+    hit.point = Vector3f(closest[0], closest[1], closest[2]);
+    hit.distance = std::sqrt(best);
+
+    return true;
+}
+// Copia hierarquia com folhas de até quatro triângulos e agrupa triângulos de cada folha para teste simultâneo
+template<typename Mesh, typename Vector3Type>
+static void buildPackets(const Mesh & triangleMesh, size_t threadCount,
+    std::vector<BoundingVolumeNode> & nodes, std::vector<TrianglePacket> & packets, size_t & depth) {
+    BoundingVolumeHierarchy hierarchy(triangleMesh, 4, threadCount);
+    const std::vector<BoundingVolumeNode> & source = hierarchy.getNodes();
+
+    depth = hierarchy.getStatistics().maximumDepth;
+
+    // Número de triângulos e primeira posição de cada subárvore (filhos sucedem o pai na pré-ordem)
+    std::vector<uint32_t> subtreeSizes(source.size()), subtreeOffsets(source.size());
+
+    for (size_t i = source.size(); i-- > 0;) {
+        const BoundingVolumeNode & node = source[i];
+
+        if (node.isLeaf()) {
+            subtreeSizes[i] = node.count;
+            subtreeOffsets[i] = node.offset;
+        }
+        else {
+            subtreeSizes[i] = subtreeSizes[i + 1] + subtreeSizes[node.offset];
+            subtreeOffsets[i] = subtreeOffsets[i + 1];
+        }
+    }
+
+    // Subárvores com até quatro triângulos se tornam uma folha com um único grupo (pares de nó de
+    // origem e nó pai cujo filho à direita aguarda índice)
+    std::vector<std::pair<uint32_t, uint32_t>> pending(1, std::make_pair(0, (uint32_t)-1));
+    std::vector<std::pair<uint32_t, uint32_t>> leaves;
+    size_t packetCount = 0;
+
+    nodes.clear();
+    nodes.reserve(source.size());
+
+    while (!pending.empty()) {
+        uint32_t index = pending.back().first;
+        uint32_t parent = pending.back().second;
+
+        pending.pop_back();
+
+        if (parent != (uint32_t)-1)
+            nodes[parent].offset = (uint32_t)nodes.size();
+
+        BoundingVolumeNode node = source[index];
+
+        if (subtreeSizes[index] <= 4) {
+            leaves.push_back(std::make_pair((uint32_t)nodes.size(), subtreeOffsets[index]));
+
+            node.offset = (uint32_t)packetCount;
+            node.count = (uint16_t)subtreeSizes[index];
+            packetCount++;
+        }
+        else {
+            // Filho à esquerda é processado primeiro e ocupa a posição seguinte ao pai
+            pending.push_back(std::make_pair(node.offset, (uint32_t)nodes.size()));
+            pending.push_back(std::make_pair(index + 1, (uint32_t)-1));
+        }
+
+        nodes.push_back(node);
+    }
+
+    nodes.shrink_to_fit();
+
+    packets.assign(packetCount, TrianglePacket());
+
+    threadPool.run(0, leaves.size(), 1 << 12, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            const BoundingVolumeNode & node = nodes[leaves[i].first];
+
+            for (size_t j = 0; j < (size_t)((node.count + 3) / 4 * 4); j++) {
+                TrianglePacket & packet = packets[node.offset + j / 4];
+                size_t lane = j % 4;
+
+                if (j >= node.count) {
+                    packet.triangles[lane] = (uint32_t)RayHit::none;
+                    continue;
+                }
+
+                size_t triangle = hierarchy.getTriangle(leaves[i].second + j);
+                size_t v0, v1, v2;
+
+                triangleMesh.getVertexIndices(triangle, v0, v1, v2);
+
+                const Vector3Type & p0 = triangleMesh.getVertex(v0);
+                const Vector3Type & p1 = triangleMesh.getVertex(v1);
+                const Vector3Type & p2 = triangleMesh.getVertex(v2);
+
+                // Arestas calculadas na precisão da geometria antes da conversão
+                for (size_t k = 0; k < 3; k++) {
+                    packet.vertex[k][lane] = (float)p0[k];
+                    packet.edge1[k][lane] = (float)(p1[k] - p0[k]);
+                    packet.edge2[k][lane] = (float)(p2[k] - p0[k]);
+                }
+
+                packet.triangles[lane] = (uint32_t)triangle;
+            }
+        }
+    }, threadCount);
+}
+
+Ray::Ray() : minimumDistance(0), maximumDistance(std::numeric_limits<float>::infinity()) {}
+Ray::Ray(const Vector3f & origin, const Vector3f & direction, float minimumDistance, float maximumDistance)
+    : origin(origin), direction(direction), minimumDistance(minimumDistance), maximumDistance(maximumDistance) {}
+Ray::~Ray() {}
+
+RayHit::RayHit() : triangle(none), u(0), v(0), distance(0) {}
+RayHit::~RayHit() {}
+
+bool RayHit::isHit() const {
+    return triangle != none;
+}
+
+PointHit::PointHit() : triangle(none), u(0), v(0), distance(0) {}
+PointHit::~PointHit() {}
+
+bool PointHit::isHit() const {
+    return triangle != none;
+}
+
+MeshIntersector::MeshIntersector() : depth(0) {}
+MeshIntersector::MeshIntersector(const TriangleMesh & triangleMesh, size_t threadCount) {
+    create(triangleMesh, threadCount);
+}
+MeshIntersector::MeshIntersector(const TriangleMeshf & triangleMesh, size_t threadCount) {
+    create(triangleMesh, threadCount);
+}
+MeshIntersector::~MeshIntersector() {}
+
+size_t MeshIntersector::getNodeCount() const {
+    return nodes.size();
+}
+size_t MeshIntersector::getMemorySize() const {
+    return nodes.size() * sizeof(BoundingVolumeNode) + packets.size() * sizeof(TrianglePacket);
+}
+bool MeshIntersector::isEmpty() const {
+    return nodes.empty();
+}
+
+bool MeshIntersector::intersect(const Ray & ray, RayHit & hit) const {
+    hit = RayHit();
+
+    if (nodes.empty())
+        return false;
+
+    return traverseRay(nodes.data(), packets.data(), depth, ray, false, hit);
+}
+bool MeshIntersector::occluded(const Ray & ray) const {
+    RayHit hit;
+
+    if (nodes.empty())
+        return false;
+
+    return traverseRay(nodes.data(), packets.data(), depth, ray, true, hit);
+}
+size_t MeshIntersector::intersect(const Ray * rays, RayHit * hits, size_t count, size_t threadCount) const {
+    if (nodes.empty()) {
+        std::fill(hits, hits + count, RayHit());
+        return 0;
+    }
+
+    std::atomic<size_t> hitCount(0);
+
+    threadPool.run(0, (count + 3) / 4, packetBlockSize, [&](size_t begin, size_t end) {
+        size_t blockHitCount = 0;
+
+        for (size_t i = begin; i < end; i++) {
+            blockHitCount += traversePacket(nodes.data(), packets.data(), depth, rays + i * 4,
+                std::min(count - i * 4, (size_t)4), false, hits + i * 4, nullptr);
+        }
+
+        hitCount += blockHitCount;
+    }, threadCount);
+
+    return hitCount;
+}
+size_t MeshIntersector::occluded(const Ray * rays, bool * results, size_t count, size_t threadCount) const {
+    if (nodes.empty()) {
+        std::fill(results, results + count, false);
+        return 0;
+    }
+
+    std::atomic<size_t> hitCount(0);
+
+    threadPool.run(0, (count + 3) / 4, packetBlockSize, [&](size_t begin, size_t end) {
+        size_t blockHitCount = 0;
+
+        for (size_t i = begin; i < end; i++) {
+            blockHitCount += traversePacket(nodes.data(), packets.data(), depth, rays + i * 4,
+                std::min(count - i * 4, (size_t)4), true, nullptr, results + i * 4);
+        }
+
+        hitCount += blockHitCount;
+    }, threadCount);
+
+    return hitCount;
+}
+bool MeshIntersector::getClosestPoint(const Vector3f & point, PointHit & hit, float maximumDistance) const {
+    hit = PointHit();
+
+    if (nodes.empty())
+        return false;
+
+    return traversePoint(nodes.data(), packets.data(), depth, point, maximumDistance, hit);
+}
+size_t MeshIntersector::getClosestPoints(const Vector3f * points, PointHit * hits, size_t count,
+    float maximumDistance, size_t threadCount) const {
+    if (nodes.empty()) {
+        std::fill(hits, hits + count, PointHit());
+        return 0;
+    }
+
+    std::atomic<size_t> hitCount(0);
+
+    threadPool.run(0, count, pointBlockSize, [&](size_t begin, size_t end) {
+        size_t blockHitCount = 0;
+
+        for (size_t i = begin; i < end; i++) {
+            hits[i] = PointHit();
+            blockHitCount += traversePoint(nodes.data(), packets.data(), depth, points[i], maximumDistance,
+                hits[i]);
+        }
+
+        hitCount += blockHitCount;
+    }, threadCount);
+
+    return hitCount;
+}
+
+MeshIntersector & MeshIntersector::create(const TriangleMesh & triangleMesh, size_t threadCount) {
+    buildPackets<TriangleMesh, Vector3>(triangleMesh, threadCount, nodes, packets, depth);
+    return *this;
+}
+MeshIntersector & MeshIntersector::create(const TriangleMeshf & triangleMesh, size_t threadCount) {
+    buildPackets<TriangleMeshf, Vector3f>(triangleMesh, threadCount, nodes, packets, depth);
+    return *this;
+}
+MeshIntersector & MeshIntersector::clear() {
+    nodes.clear();
+    packets.clear();
+    depth = 0;
+
+    return *this;
+}
@@ -0,0 +1,694 @@
+// File:    MeshOptimizer.cpp
+// Author:  Danilo Peixoto
+// Date:    17/10/2026
+
+#include <MeshOptimizer.h>
+#include <IndexBuffer.h>
+#include <TriangleMesh.h>
+#include <VertexBuffer.h>
+#include <Vector.h>
+#include <Thread.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+
+// Simula memória FIFO de vértices transformados e retorna número de transformações
+// (vértices utilizados são contados em "usedCount")
+static size_t simulateVertexCache(const IndexBuffer & indices, size_t cacheSize, size_t & usedCount) {
+    std::vector<size_t> cacheTime(indices.isEmpty() ? 0 : indices.getMaximum() + 1, 0);
+
+    // Vértice está na memória se foi inserido há no máximo "cacheSize" inserções
+    size_t time = cacheSize + 1;
+    size_t missCount = 0;
+
+    usedCount = 0;
+
+    for (size_t i = 0; i < indices.getSize(); i++) {
+        size_t & vertexTime = cacheTime[indices[i]];
+
+        if (vertexTime == 0)
+            usedCount++;
+
+        if (time - vertexTime > cacheSize) {
+            vertexTime = time++;
+            missCount++;
+        }
+    }
+
+    return missCount;
+}
+
+// Intercala os 21 bits menos significativos com dois bits nulos entre cada bit
+static uint64_t expandBits(uint64_t v) {
+    v &= UINT64_C(0x1FFFFF);
+    v = (v | v << 32) & UINT64_C(0x1F00000000FFFF);
+    v = (v | v << 16) & UINT64_C(0x1F0000FF0000FF);
+    v = (v | v << 8) & UINT64_C(0x100F00F00F00F00F);
+    v = (v | v << 4) & UINT64_C(0x10C30C30C30C30C3);
+    v = (v | v << 2) & UINT64_C(0x1249249249249249);
+
+    return v;
+}
+// Converte coordenada para inteiro em [0, maximum] (limites protegem contra erros de arredondamento)
+static uint64_t quantize(double value, double minimum, double scale, uint64_t maximum) {
+    double position = (value - minimum) * scale;
+
+    if (position <= 0)
+        return 0;
+
+    return std::min((uint64_t)position, maximum);
+}
+// Calcula códigos de Morton dos centróides dos triângulos em paralelo
+template<typename Mesh, typename Vector3Type>
+static std::vector<uint64_t> computeMortonCodes(const Mesh & triangleMesh, size_t bits,
+    size_t threadCount) {
+    size_t triangleCount = triangleMesh.getTriangleCount();
+    std::vector<uint64_t> codes(triangleCount);
+
+    if (triangleCount == 0)
+        return codes;
+
+    // Caixa envolvente dos vértices contém todos centróides (mantida pela geometria entre consultas)
+    const size_t blockSize = 1 << 16;
+    const BoundingBox & boundingBox = triangleMesh.getBoundingBox();
+    uint64_t maximumCoordinate = (UINT64_C(1) << bits / 3) - 1;
+    double minimum[3], scale[3];
+
+    for (size_t k = 0; k < 3; k++) {
+        // Centróide é a soma dos vértices dividida por três (divisão incorporada na escala)
+        double extent = boundingBox.maximum[k] - boundingBox.minimum[k];
+        scale[k] = extent > 0 ? maximumCoordinate / (extent * 3) : 0;
+        minimum[k] = boundingBox.minimum[k] * 3;
+    }
+
+    size_t blockCount = (triangleCount + blockSize - 1) / blockSize;
+
+    threadPool.run(blockCount, [&](size_t i) {
+        for (size_t j = i * blockSize; j < std::min((i + 1) * blockSize, triangleCount); j++) {
+            size_t v0, v1, v2;
+            triangleMesh.getVertexIndices(j, v0, v1, v2);
+
+            const Vector3Type & p0 = triangleMesh.getVertex(v0);
+            const Vector3Type & p1 = triangleMesh.getVertex(v1);
+            const Vector3Type & p2 = triangleMesh.getVertex(v2);
+
+            uint64_t x = quantize((double)p0.x + p1.x + p2.x, minimum[0], scale[0], maximumCoordinate);
+            uint64_t y = quantize((double)p0.y + p1.y + p2.y, minimum[1], scale[1], maximumCoordinate);
+            uint64_t z = quantize((double)p0.z + p1.z + p2.z, minimum[2], scale[2], maximumCoordinate);
+
+            codes[j] = expandBits(x) << 2 | expandBits(y) << 1 | expandBits(z);
+        }
+    }, threadCount);
+
+    return codes;
+}
+// Reordena triângulos pela curva de Morton dos centróides
+template<typename Mesh>
+static void sortTriangles(Mesh * triangleMesh, bool reorderAttributes, size_t bits, size_t threadCount) {
+    // Ordenação cobre todos os bits dos códigos gerados (30 ou 63)
+    bits = bits > 30 ? 63 : 30;
+
+    triangleMesh->reorderTriangles(sortMortonCodes(
+        getMortonCodes(*triangleMesh, bits, threadCount), bits, threadCount));
+
+    // Primeiro uso na nova ordem de triângulos também segue a curva de Morton
+    if (reorderAttributes)
+        optimizeVertexFetch(triangleMesh);
+}
+
+// Aresta das células da grade de união em múltiplos da tolerância
+static const double cellScale = 8;
+// Deslocamento da grade em frações de célula (coordenadas redondas raramente caem perto das faces)
+static const double cellOffset = 0.381966;
+
+// Mistura bits de um inteiro de 64 bits (finalizador SplitMix64)
+static uint64_t mixBits(uint64_t x) {
+    x += UINT64_C(0x9E3779B97F4A7C15);
+    x = (x ^ x >> 30) * UINT64_C(0xBF58476D1CE4E5B9);
+    x = (x ^ x >> 27) * UINT64_C(0x94D049BB133111EB);
+
+    return x ^ x >> 31;
+}
+// Retorna chave não nula de uma célula da grade espacial
+static uint64_t hashCell(int64_t x, int64_t y, int64_t z) {
+    return mixBits((uint64_t)x ^ mixBits((uint64_t)y ^ mixBits((uint64_t)z))) | 1;
+}
+// Retorna coordenada inteira da célula (bits do valor quando não há tolerância)
+static int64_t getCell(double value, double inverseCellSize) {
+    if (inverseCellSize == 0) {
+        // Soma com zero converte "-0" em "0"
+        value += 0.0;
+
+        int64_t bits;
+        std::memcpy(&bits, &value, sizeof(double));
+
+        return bits;
+    }
+
+    return (int64_t)std::floor(value * inverseCellSize + cellOffset);
+}
+// Retorna raiz do conjunto do elemento (caminho é encurtado durante a busca, seguro entre threads)
+template<typename Index>
+static Index findSet(std::vector<std::atomic<Index>> & parents, Index i) {
+    while (true) {
+        Index parent = parents[i].load(std::memory_order_relaxed);
+
+        if (parent == i)
+            return i;
+
+        Index grandparent = parents[parent].load(std::memory_order_relaxed);
+
+        if (parent != grandparent)
+            parents[i].compare_exchange_weak(parent, grandparent, std::memory_order_relaxed);
+
+        i = grandparent;
+    }
+}
+// Une conjuntos de dois elementos sem bloqueio (raiz é sempre o menor elemento do conjunto)
+template<typename Index>
+static void uniteSets(std::vector<std::atomic<Index>> & parents, Index a, Index b) {
+    while (true) {
+        a = findSet(parents, a);
+        b = findSet(parents, b);
+
+        if (a == b)
+            return;
+
+        if (a < b)
+            std::swap(a, b);
+
+        // Falha indica que outra thread ligou a raiz maior enquanto isso
+        Index expected = a;
+
+        if (parents[a].compare_exchange_strong(expected, b))
+            return;
+    }
+}
+// Une vértices a menos de "epsilon" em paralelo e retorna nova posição de cada vértice (índices de vértices e
+// células do tipo "Index")
+template<typename Index, typename Mesh, typename Vector3Type>
+static std::vector<size_t> groupWeldVertices(const Mesh & triangleMesh, double epsilon, size_t threadCount,
+    size_t & weldedCount) {
+    const size_t grainSize = 1 << 14;
+
+    size_t vertexCount = triangleMesh.getVertexCount();
+    const std::vector<Vector3Type> & vertices = triangleMesh.getVertices();
+
+    // Células muito maiores que a tolerância: maioria dos vértices não precisa consultar células vizinhas
+    double cellSize = epsilon * cellScale;
+    double inverseCellSize = epsilon > 0 ? 1 / cellSize : 0;
+    double squaredEpsilon = epsilon * epsilon;
+
+    size_t capacity = 16;
+
+    while (capacity < vertexCount * 2)
+        capacity *= 2;
+
+    // Tabela de endereçamento aberto com chaves das células ocupadas (inserção paralela sem bloqueio)
+    std::vector<std::atomic<uint64_t>> keys(capacity);
+    std::vector<Index> slots(vertexCount);
+
+    threadPool.run(0, capacity, grainSize, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++)
+            keys[i].store(0, std::memory_order_relaxed);
+    }, threadCount);
+
+    threadPool.run(0, vertexCount, grainSize, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            const Vector3Type & vertex = vertices[i];
+            uint64_t key = hashCell(getCell(vertex.x, inverseCellSize), getCell(vertex.y, inverseCellSize),
+                getCell(vertex.z, inverseCellSize));
+
+            size_t slot = key & (capacity - 1);
+
+            while (true) {
+                uint64_t current = keys[slot].load(std::memory_order_relaxed);
+
+                if (current == 0 && keys[slot].compare_exchange_strong(current, key))
+                    break;
+
+                if (current == key)
+                    break;
+
+                slot = (slot + 1) & (capacity - 1);
+            }
+
+            slots[i] = (Index)slot;
+        }
+    }, threadCount);
+
+    // Vértices agrupados por célula em ordem crescente com posições contíguas (ordenação por contagem)
+    std::vector<Index> offsets(capacity + 1, 0);
+    std::vector<Index> cellVertices(vertexCount);
+    std::vector<Vector3Type> cellPositions(vertexCount);
+
+    for (size_t i = 0; i < vertexCount; i++)
+        offsets[slots[i] + 1]++;
+
+    for (size_t i = 0; i < capacity; i++)
+        offsets[i + 1] += offsets[i];
+
+    for (size_t i = 0; i < vertexCount; i++) {
+        Index position = offsets[slots[i]]++;
+
+        cellVertices[position] = (Index)i;
+        cellPositions[position] = vertices[i];
+    }
+
+    for (size_t i = capacity; i > 0; i--)
+        offsets[i] = offsets[i - 1];
+
+    offsets[0] = 0;
+    std::vector<Index>().swap(slots);
+
+    // Vértices a menos de "epsilon" são unidos em conjuntos (vértices percorridos na ordem das células
+    // para que consultas à própria célula sejam sequenciais)
+    std::vector<std::atomic<Index>> parents(vertexCount);
+
+    threadPool.run(0, vertexCount, grainSize, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++)
+            parents[i].store((Index)i, std::memory_order_relaxed);
+    }, threadCount);
+
+    threadPool.run(0, capacity, grainSize * 4, [&](size_t begin, size_t end) {
+        for (size_t slot = begin; slot < end; slot++) {
+            for (size_t i = offsets[slot]; i < offsets[slot + 1]; i++) {
+                const Vector3Type & vertex = cellPositions[i];
+                double position[3] = {vertex.x, vertex.y, vertex.z};
+                Index index = cellVertices[i];
+
+                // Cada par é testado uma única vez pelo vértice de maior índice
+                for (size_t k = offsets[slot]; k < i; k++) {
+                    const Vector3Type & other = cellPositions[k];
+
+                    double dx = other.x - position[0];
+                    double dy = other.y - position[1];
+                    double dz = other.z - position[2];
+
+                    if (dx * dx + dy * dy + dz * dz <= squaredEpsilon)
+                        uniteSets(parents, index, cellVertices[k]);
+                }
+
+                // Células vizinhas só são consultadas perto das faces da célula
+                int64_t cell[3], side[3];
+
+                if (epsilon > 0) {
+                    for (size_t k = 0; k < 3; k++) {
+                        cell[k] = getCell(position[k], inverseCellSize);
+
+                        double offset = position[k] - (cell[k] - cellOffset) * cellSize;
+                        side[k] = offset < epsilon ? -1 : (cellSize - offset <= epsilon ? 1 : 0);
+                    }
+                }
+                else {
+                    cell[0] = cell[1] = cell[2] = 0;
+                    side[0] = side[1] = side[2] = 0;
+                }
+
+                for (size_t j = 1; j < 8; j++) {
+                    if ((j & 1 && !side[0]) || (j & 2 && !side[1]) || (j & 4 && !side[2]))
+                        continue;
+
+                    uint64_t key = hashCell(cell[0] + (j & 1 ? side[0] : 0), cell[1] + (j & 2 ? side[1] : 0),
+                        cell[2] + (j & 4 ? side[2] : 0));
+
+                    size_t neighbor = key & (capacity - 1);
+                    uint64_t current;
+
+                    while ((current = keys[neighbor].load(std::memory_order_relaxed)) != key && current != 0)
+                        neighbor = (neighbor + 1) & (capacity - 1);
+
+                    // Células com chaves iguais compartilham o grupo já testado
+                    if (current == 0 || neighbor == slot)
+                        continue;
+
+                    for (size_t k = offsets[neighbor]; k < offsets[neighbor + 1] && cellVertices[k] < index; k++) {
+                        const Vector3Type & other = cellPositions[k];
+
+                        double dx = other.x - position[0];
+                        double dy = other.y - position[1];
+                        double dz = other.z - position[2];
+
+                        if (dx * dx + dy * dy + dz * dz <= squaredEpsilon)
+                            uniteSets(parents, index, cellVertices[k]);
+                    }
+                }
+            }
+        }
+    }, threadCount);
+
+    // Grupos são numerados na ordem do menor vértice (raiz sempre precede os demais elementos)
+    std::vector<size_t> remap(vertexCount);
+    weldedCount = 0;
+
+    for (size_t i = 0; i < vertexCount; i++) {
+        Index root = findSet(parents, (Index)i);
+        remap[i] = root == i ? weldedCount++ : remap[root];
+    }
+
+    return remap;
+}
+// Une vértices a menos de "epsilon" e retorna nova posição de cada vértice (índices de 32 bits reduzem a memória
+// das tabelas; tabela de células com "2 * vertexCount" posições exige 64 bits a partir de 2^31 vértices)
+template<typename Mesh, typename Vector3Type>
+static std::vector<size_t> computeWeldRemap(const Mesh & triangleMesh, double epsilon, size_t threadCount,
+    size_t & weldedCount) {
+    if (triangleMesh.getVertexCount() < ((size_t)1 << 31))
+        return groupWeldVertices<uint32_t, Mesh, Vector3Type>(triangleMesh, epsilon, threadCount, weldedCount);
+
+    return groupWeldVertices<uint64_t, Mesh, Vector3Type>(triangleMesh, epsilon, threadCount, weldedCount);
+}
+// Une vértices próximos e remove triângulos degenerados resultantes
+template<typename Mesh, typename Vector3Type, typename Vector2Type>
+static size_t weldMesh(Mesh * triangleMesh, double epsilon, size_t threadCount) {
+    size_t vertexCount = triangleMesh->getVertexCount(), weldedCount;
+    std::vector<size_t> remap = computeWeldRemap<Mesh, Vector3Type>(*triangleMesh, epsilon, threadCount,
+        weldedCount);
+
+    std::vector<Vector3Type> vertices, normals, weldedVertices(weldedCount);
+    std::vector<Vector2Type> textureCoordinates;
+    std::vector<size_t> vertexIndices, normalIndices, textureIndices;
+
+    triangleMesh->release(vertices, normals, textureCoordinates, vertexIndices, normalIndices, textureIndices);
+
+    // Vértice unido mantém a posição do representante (primeiro vértice do grupo)
+    for (size_t i = vertexCount; i > 0; i--)
+        weldedVertices[remap[i - 1]] = vertices[i - 1];
+
+    std::vector<Vector3Type>().swap(vertices);
+
+    bool hasNormals = !normalIndices.empty();
+    bool hasTextureCoordinates = !textureIndices.empty();
+    size_t triangleCount = 0;
+
+    for (size_t i = 0; i < vertexIndices.size(); i += 3) {
+        size_t v0 = remap[vertexIndices[i]];
+        size_t v1 = remap[vertexIndices[i + 1]];
+        size_t v2 = remap[vertexIndices[i + 2]];
+
+        if (v0 == v1 || v1 == v2 || v2 == v0)
+            continue;
+
+        size_t j = triangleCount++ * 3;
+
+        vertexIndices[j] = v0;
+        vertexIndices[j + 1] = v1;
+        vertexIndices[j + 2] = v2;
+
+        if (hasNormals)
+            std::copy(&normalIndices[i], &normalIndices[i] + 3, &normalIndices[j]);
+
+        if (hasTextureCoordinates)
+            std::copy(&textureIndices[i], &textureIndices[i] + 3, &textureIndices[j]);
+    }
+
+    vertexIndices.resize(triangleCount * 3);
+
+    if (hasNormals)
+        normalIndices.resize(triangleCount * 3);
+
+    if (hasTextureCoordinates)
+        textureIndices.resize(triangleCount * 3);
+
+    // Listas de índices voltam à menor largura capaz de representá-los
+    triangleMesh->create(std::move(weldedVertices), std::move(normals), std::move(textureCoordinates),
+        IndexBuffer(std::move(vertexIndices)), IndexBuffer(std::move(normalIndices)),
+        IndexBuffer(std::move(textureIndices)));
+
+    return vertexCount - weldedCount;
+}
+
+std::vector<size_t> getVertexCacheOrder(const IndexBuffer & indices, size_t vertexCount,
+    size_t cacheSize) {
+    size_t triangleCount = indices.getSize() / 3;
+
+    // Triângulos adjacentes a cada vértice (lista compacta indexada por "offsets")
+    std::vector<size_t> offsets(vertexCount + 1, 0);
+
+    for (size_t i = 0; i < triangleCount * 3; i++)
+        offsets[indices[i] + 1]++;
+
+    for (size_t i = 0; i < vertexCount; i++)
+        offsets[i + 1] += offsets[i];
+
+    std::vector<size_t> adjacency(triangleCount * 3);
+    std::vector<size_t> liveCount(vertexCount);
+
+    {
+        std::vector<size_t> position(offsets.begin(), offsets.end() - 1);
+
+        for (size_t i = 0; i < triangleCount * 3; i++)
+            adjacency[position[indices[i]]++] = i / 3;
+    }
+
+    for (size_t i = 0; i < vertexCount; i++)
+        liveCount[i] = offsets[i + 1] - offsets[i];
+
+    std::vector<size_t> cacheTime(vertexCount, 0);
+    std::vector<char> emitted(triangleCount, 0);
+    std::vector<size_t> deadEnd, candidates;
+    std::vector<size_t> order;
+
+    order.reserve(triangleCount);
+    deadEnd.reserve(triangleCount * 3);
+
+    size_t time = cacheSize + 1;
+    size_t cursor = 0;
+    size_t fan = 0;
+
+    // Vértice inicial é o primeiro vértice utilizado
+    while (fan < vertexCount && liveCount[fan] == 0)
+        fan++;
+
+    while (fan < vertexCount) {
+        candidates.clear();
+
+        // Emite todos triângulos pendentes ao redor do vértice atual
+        for (size_t i = offsets[fan]; i < offsets[fan + 1]; i++) {
+            size_t triangle = adjacency[i];
+
+            if (emitted[triangle])
+                continue;
+
+            emitted[triangle] = 1;
+            order.push_back(triangle);
+
+            for (size_t j = 0; j < 3; j++) {
+                size_t vertex = indices[triangle * 3 + j];
+
+                deadEnd.push_back(vertex);
+                candidates.push_back(vertex);
+                liveCount[vertex]--;
+
+                if (time - cacheTime[vertex] > cacheSize)
+                    cacheTime[vertex] = time++;
+            }
+        }
+
+        // Próximo vértice é o candidato mais antigo que ainda permanecerá na memória após emitir seus triângulos
+        size_t next = vertexCount;
+        size_t bestPriority = 0;
+
+        for (size_t i = 0; i < candidates.size(); i++) {
+            size_t vertex = candidates[i];
+
+            if (liveCount[vertex] == 0)
+                continue;
+
+            size_t age = time - cacheTime[vertex];
+            size_t priority = age + 2 * liveCount[vertex] <= cacheSize ? age + 1 : 1;
+
+            if (priority > bestPriority) {
+                bestPriority = priority;
+                next = vertex;
+            }
+        }
+
+        // Sem candidatos: retoma vértices recentes com triângulos pendentes ou segue a ordem dos vértices
+        while (next == vertexCount && !deadEnd.empty()) {
+            size_t vertex = deadEnd.back();
+            deadEnd.pop_back();
+
+            if (liveCount[vertex] > 0)
+                next = vertex;
+        }
+
+        while (next == vertexCount && cursor < vertexCount) {
+            if (liveCount[cursor] > 0)
+                next = cursor;
+
+            cursor++;
+        }
+
+        fan = next;
+    }
+
+    return order;
+}
+
+void optimizeVertexCache(TriangleMesh * triangleMesh, size_t cacheSize) {
+    triangleMesh->reorderTriangles(getVertexCacheOrder(triangleMesh->getVertexIndices(),
+        triangleMesh->getVertexCount(), cacheSize));
+}
+void optimizeVertexCache(TriangleMeshf * triangleMesh, size_t cacheSize) {
+    triangleMesh->reorderTriangles(getVertexCacheOrder(triangleMesh->getVertexIndices(),
+        triangleMesh->getVertexCount(), cacheSize));
+}
+void optimizeVertexCache(VertexBuffer * vertexBuffer, size_t cacheSize) {
+    vertexBuffer->reorderTriangles(getVertexCacheOrder(vertexBuffer->getIndices(),
+        vertexBuffer->getVertexCount(), cacheSize));
+}
+
+std::vector<size_t> getVertexFetchRemap(const IndexBuffer & indices, size_t count) {
+    // Posição "count" indica elemento ainda não referenciado
+    std::vector<size_t> remap(count, count);
+    size_t next = 0;
+
+    for (size_t i = 0; i < indices.getSize(); i++) {
+        size_t & position = remap[indices[i]];
+
+        if (position == count)
+            position = next++;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        if (remap[i] == count)
+            remap[i] = next++;
+    }
+
+    return remap;
+}
+void optimizeVertexFetch(TriangleMesh * triangleMesh) {
+    triangleMesh->reorderAttributes(
+        getVertexFetchRemap(triangleMesh->getVertexIndices(), triangleMesh->getVertexCount()),
+        getVertexFetchRemap(triangleMesh->getNormalIndices(), triangleMesh->getNormalCount()),
+        getVertexFetchRemap(triangleMesh->getTextureIndices(), triangleMesh->getTextureCoordinateCount()));
+}
+void optimizeVertexFetch(TriangleMeshf * triangleMesh) {
+    triangleMesh->reorderAttributes(
+        getVertexFetchRemap(triangleMesh->getVertexIndices(), triangleMesh->getVertexCount()),
+        getVertexFetchRemap(triangleMesh->getNormalIndices(), triangleMesh->getNormalCount()),
+        getVertexFetchRemap(triangleMesh->getTextureIndices(), triangleMesh->getTextureCoordinateCount()));
+}
+void optimizeVertexFetch(VertexBuffer * vertexBuffer) {
+    vertexBuffer->reorderVertices(getVertexFetchRemap(vertexBuffer->getIndices(),
+        vertexBuffer->getVertexCount()));
+}
+
+std::vector<uint64_t> getMortonCodes(const TriangleMesh & triangleMesh, size_t bits,
+    size_t threadCount) {
+    return computeMortonCodes<TriangleMesh, Vector3>(triangleMesh, bits > 30 ? 63 : 30, threadCount);
+}
+std::vector<uint64_t> getMortonCodes(const TriangleMeshf & triangleMesh, size_t bits,
+    size_t threadCount) {
+    return computeMortonCodes<TriangleMeshf, Vector3f>(triangleMesh, bits > 30 ? 63 : 30, threadCount);
+}
+std::vector<size_t> sortMortonCodes(const std::vector<uint64_t> & codes, size_t bits,
+    size_t threadCount) {
+    size_t count = codes.size();
+
+    if (threadCount == 0)
+        threadCount = threadPool.getThreadCount();
+
+    // Blocos pequenos não compensam o custo de sincronização
+    const size_t minimumBlockSize = 1 << 16;
+    const size_t digitBits = 11;
+    const size_t radix = 1 << digitBits;
+
+    size_t blockCount = std::max(std::min(threadCount, count / minimumBlockSize), (size_t)1);
+    size_t blockSize = (count + blockCount - 1) / blockCount;
+
+    std::vector<uint64_t> keys(codes), sortedKeys(count);
+    std::vector<size_t> order(count), sortedOrder(count);
+    std::vector<size_t> offsets(blockCount * radix);
+
+    for (size_t i = 0; i < count; i++)
+        order[i] = i;
+
+    // Ordenação por dígitos de 11 bits do menos significativo ao mais significativo (cada passo é estável)
+    for (size_t shift = 0; shift < bits; shift += digitBits) {
+        threadPool.run(blockCount, [&](size_t i) {
+            size_t * histogram = &offsets[i * radix];
+            std::fill(histogram, histogram + radix, 0);
+
+            for (size_t j = i * blockSize; j < std::min((i + 1) * blockSize, count); j++)
+                histogram[keys[j] >> shift & (radix - 1)]++;
+        }, threadCount);
+
+        // Posição inicial de cada dígito em cada bloco (dígitos em ordem, blocos em ordem dentro do dígito)
+        size_t position = 0;
+        bool isSorted = false;
+
+        for (size_t digit = 0; digit < radix && !isSorted; digit++) {
+            size_t start = position;
+
+            for (size_t i = 0; i < blockCount; i++) {
+                size_t & offset = offsets[i * radix + digit];
+                size_t digitCount = offset;
+
+                offset = position;
+                position += digitCount;
+            }
+
+            // Dígito comum a todos códigos não altera a ordem
+            isSorted = position - start == count;
+        }
+
+        if (isSorted)
+            continue;
+
+        threadPool.run(blockCount, [&](size_t i) {
+            size_t * offset = &offsets[i * radix];
+
+            for (size_t j = i * blockSize; j < std::min((i + 1) * blockSize, count); j++) {
+                size_t k = offset[keys[j] >> shift & (radix - 1)]++;
+
+                sortedKeys[k] = keys[j];
+                sortedOrder[k] = order[j];
+            }
+        }, threadCount);
+
+        keys.swap(sortedKeys);
+        order.swap(sortedOrder);
+    }
+
+    return order;
+}
+void optimizeSpatialOrder(TriangleMesh * triangleMesh, bool reorderAttributes, size_t bits,
+    size_t threadCount) {
+    sortTriangles(triangleMesh, reorderAttributes, bits, threadCount);
+}
+void optimizeSpatialOrder(TriangleMeshf * triangleMesh, bool reorderAttributes, size_t bits,
+    size_t threadCount) {
+    sortTriangles(triangleMesh, reorderAttributes, bits, threadCount);
+}
+
+std::vector<size_t> getVertexWeldRemap(const TriangleMesh & triangleMesh, double epsilon, size_t threadCount) {
+    size_t weldedCount;
+    return computeWeldRemap<TriangleMesh, Vector3>(triangleMesh, epsilon, threadCount, weldedCount);
+}
+std::vector<size_t> getVertexWeldRemap(const TriangleMeshf & triangleMesh, double epsilon, size_t threadCount) {
+    size_t weldedCount;
+    return computeWeldRemap<TriangleMeshf, Vector3f>(triangleMesh, epsilon, threadCount, weldedCount);
+}
+size_t weldVertices(TriangleMesh * triangleMesh, double epsilon, size_t threadCount) {
+    return weldMesh<TriangleMesh, Vector3, Vector2>(triangleMesh, epsilon, threadCount);
+}
+size_t weldVertices(TriangleMeshf * triangleMesh, double epsilon, size_t threadCount) {
+    return weldMesh<TriangleMeshf, Vector3f, Vector2f>(triangleMesh, epsilon, threadCount);
+}
+
+double getAverageCacheMissRatio(const IndexBuffer & indices, size_t cacheSize) {
+    size_t triangleCount = indices.getSize() / 3, usedCount;
+    size_t missCount = simulateVertexCache(indices, cacheSize, usedCount);
+
+    return triangleCount ? (double)missCount / triangleCount : 0;
+}
+double getAverageTransformRatio(const IndexBuffer & indices, size_t cacheSize) {
+    size_t usedCount;
+    size_t missCount = simulateVertexCache(indices, cacheSize, usedCount);
+
+    return usedCount ? (double)missCount / usedCount : 0;
+}
@@ -0,0 +1,239 @@
+// File:    MeshTopology.cpp
+// Author:  Danilo Peixoto
+// Date:    17/10/2026
+
+#include <MeshTopology.h>
+#include <TriangleMesh.h>
+
+#include <algorithm>
+
+const size_t MeshTopology::none = (size_t)-1;
+
+// Semiaresta inexistente nas listas de 32 bits
+static const uint32_t invalid = UINT32_MAX;
+
+MeshTopology::MeshTopology() : boundaryEdgeCount(0), nonManifoldEdgeCount(0) {}
+MeshTopology::MeshTopology(const IndexBuffer & vertexIndices, size_t vertexCount) {
+    create(vertexIndices, vertexCount);
+}
+MeshTopology::MeshTopology(const TriangleMesh & triangleMesh) {
+    create(triangleMesh);
+}
+MeshTopology::MeshTopology(const TriangleMeshf & triangleMesh) {
+    create(triangleMesh);
+}
+MeshTopology::~MeshTopology() {}
+
+size_t MeshTopology::getHalfEdgeCount() const {
+    return origins.size();
+}
+size_t MeshTopology::getTriangleCount() const {
+    return origins.size() / 3;
+}
+size_t MeshTopology::getVertexCount() const {
+    return vertexEdges.size();
+}
+size_t MeshTopology::getBoundaryEdgeCount() const {
+    return boundaryEdgeCount;
+}
+size_t MeshTopology::getNonManifoldEdgeCount() const {
+    return nonManifoldEdgeCount;
+}
+size_t MeshTopology::getMemorySize() const {
+    return (origins.capacity() + twins.capacity() + vertexEdges.capacity()) * sizeof(uint32_t);
+}
+bool MeshTopology::isEmpty() const {
+    return origins.empty();
+}
+
+size_t MeshTopology::getVertexEdge(size_t v) const {
+    return vertexEdges[v] == invalid ? none : vertexEdges[v];
+}
+bool MeshTopology::isBoundaryVertex(size_t v) const {
+    // Semiaresta do vértice é de borda sempre que o leque estiver aberto
+    return vertexEdges[v] != invalid && twins[vertexEdges[v]] == invalid;
+}
+
+void MeshTopology::getTriangleNeighbors(size_t t, size_t & t0, size_t & t1, size_t & t2) const {
+    size_t h = t * 3;
+
+    t0 = twins[h] == invalid ? none : twins[h] / 3;
+    t1 = twins[h + 1] == invalid ? none : twins[h + 1] / 3;
+    t2 = twins[h + 2] == invalid ? none : twins[h + 2] / 3;
+}
+void MeshTopology::getVertexEdges(size_t v, std::vector<size_t> & edges) const {
+    edges.clear();
+
+    uint32_t start = vertexEdges[v];
+
+    if (start == invalid)
+        return;
+
+    // Leque aberto começa pela semiaresta de borda e termina na semiaresta anterior sem oposta
+    uint32_t h = start;
+
+    do {
+        edges.push_back(h);
+        h = twins[getPrevious(h)];
+    } while (h != invalid && h != start);
+}
+void MeshTopology::getVertexTriangles(size_t v, std::vector<size_t> & triangles) const {
+    getVertexEdges(v, triangles);
+
+    for (size_t i = 0; i < triangles.size(); i++)
+        triangles[i] /= 3;
+}
+void MeshTopology::getVertexNeighbors(size_t v, std::vector<size_t> & neighbors) const {
+    getVertexEdges(v, neighbors);
+
+    if (neighbors.empty())
+        return;
+
+    // Leque aberto inclui origem da última aresta de entrada
+    size_t last = getPrevious(neighbors.back());
+
+    for (size_t i = 0; i < neighbors.size(); i++)
+        neighbors[i] = getTarget(neighbors[i]);
+
+    if (twins[last] == invalid)
+        neighbors.push_back(origins[last]);
+}
+void MeshTopology::getBoundaryLoops(std::vector<std::vector<size_t>> & loops) const {
+    loops.clear();
+
+    std::vector<char> visited(origins.size(), 0);
+
+    for (size_t i = 0; i < origins.size(); i++) {
+        if (twins[i] != invalid || visited[i])
+            continue;
+
+        std::vector<size_t> loop;
+        size_t h = i;
+
+        // Próxima semiaresta de borda é encontrada girando ao redor do destino até a borda
+        while (!visited[h]) {
+            visited[h] = 1;
+            loop.push_back(origins[h]);
+
+            h = getNext(h);
+
+            while (twins[h] != invalid)
+                h = getNext(twins[h]);
+        }
+
+        loops.push_back(loop);
+    }
+}
+
+MeshTopology & MeshTopology::create(const IndexBuffer & vertexIndices, size_t vertexCount) {
+    size_t halfEdgeCount = vertexIndices.getSize();
+
+    origins.resize(halfEdgeCount);
+    twins.assign(halfEdgeCount, invalid);
+    vertexEdges.assign(vertexCount, invalid);
+
+    boundaryEdgeCount = 0;
+    nonManifoldEdgeCount = 0;
+
+    // Semiarestas não degeneradas agrupadas pelo menor vértice da aresta (ordenação por contagem)
+    std::vector<uint32_t> offsets(vertexCount + 1, 0);
+    std::vector<uint32_t> buckets(halfEdgeCount);
+
+    for (size_t h = 0; h < halfEdgeCount; h++)
+        origins[h] = (uint32_t)vertexIndices[h];
+
+    for (size_t h = 0; h < halfEdgeCount; h++) {
+        uint32_t a = origins[h], b = origins[getNext(h)];
+
+        if (a != b)
+            offsets[std::min(a, b) + 1]++;
+    }
+
+    for (size_t v = 0; v < vertexCount; v++)
+        offsets[v + 1] += offsets[v];
+
+    for (size_t h = 0; h < halfEdgeCount; h++) {
+        uint32_t a = origins[h], b = origins[getNext(h)];
+
+        if (a != b)
+            buckets[offsets[std::min(a, b)]++] = (uint32_t)h;
+    }
+
+    for (size_t v = vertexCount; v > 0; v--)
+        offsets[v] = offsets[v - 1];
+
+    offsets[0] = 0;
+
+    // Semiarestas de cada aresta "a - b" do grupo "a" são contadas no maior vértice "b" (custo linear no
+    // número de semiarestas, independente da valência)
+    std::vector<uint32_t> forwardEdges(vertexCount), backwardEdges(vertexCount);
+    std::vector<uint32_t> forwardCounts(vertexCount, 0), backwardCounts(vertexCount, 0);
+
+    for (size_t a = 0; a < vertexCount; a++) {
+        for (size_t i = offsets[a]; i < offsets[a + 1]; i++) {
+            uint32_t h = buckets[i];
+
+            if (origins[h] == a) {
+                uint32_t b = origins[getNext(h)];
+
+                forwardEdges[b] = h;
+                forwardCounts[b]++;
+            }
+            else {
+                uint32_t b = origins[h];
+
+                backwardEdges[b] = h;
+                backwardCounts[b]++;
+            }
+        }
+
+        // Oposta de "a -> b" é a única semiaresta "b -> a" (aresta com outras semiarestas fica na borda)
+        for (size_t i = offsets[a]; i < offsets[a + 1]; i++) {
+            uint32_t h = buckets[i];
+            uint32_t b = origins[h] == a ? origins[getNext(h)] : origins[h];
+
+            // Contadores nulos indicam aresta já classificada
+            if (forwardCounts[b] + backwardCounts[b] == 0)
+                continue;
+
+            if (forwardCounts[b] == 1 && backwardCounts[b] == 1) {
+                twins[forwardEdges[b]] = backwardEdges[b];
+                twins[backwardEdges[b]] = forwardEdges[b];
+            }
+            else if (forwardCounts[b] + backwardCounts[b] > 2)
+                nonManifoldEdgeCount++;
+
+            forwardCounts[b] = 0;
+            backwardCounts[b] = 0;
+        }
+    }
+
+    for (size_t h = 0; h < halfEdgeCount; h++) {
+        uint32_t & edge = vertexEdges[origins[h]];
+
+        if (twins[h] == invalid) {
+            boundaryEdgeCount++;
+            edge = (uint32_t)h;
+        }
+        else if (edge == invalid)
+            edge = (uint32_t)h;
+    }
+
+    return *this;
+}
+MeshTopology & MeshTopology::create(const TriangleMesh & triangleMesh) {
+    return create(triangleMesh.getVertexIndices(), triangleMesh.getVertexCount());
+}
+MeshTopology & MeshTopology::create(const TriangleMeshf & triangleMesh) {
+    return create(triangleMesh.getVertexIndices(), triangleMesh.getVertexCount());
+}
+MeshTopology & MeshTopology::clear() {
+    origins.clear();
+    twins.clear();
+    vertexEdges.clear();
+
+    boundaryEdgeCount = 0;
+    nonManifoldEdgeCount = 0;
+
+    return *this;
+}
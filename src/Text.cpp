@@ -0,0 +1,532 @@
+// File:    Text.cpp
+// Author:  Danilo Peixoto
+// Date:    16/10/2026
+
+#include <Text.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+#include <string>
+
+// Potências de 10 representadas exatamente em precisão dupla
+static const double exactPowersOfTen[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+// Conversão completa pela biblioteca padrão (casos fora do caminho rápido)
+static const char * parseRealFallback(const char * begin, const char * end, double & value) {
+    const char * tokenEnd = begin;
+
+    while (tokenEnd != end && !isSpace(*tokenEnd) && *tokenEnd != '\n')
+        tokenEnd++;
+
+    size_t length = tokenEnd - begin;
+    char buffer[128];
+
+    std::string token;
+    const char * text = buffer;
+
+    if (length < sizeof(buffer)) {
+        for (size_t i = 0; i < length; i++)
+            buffer[i] = begin[i];
+
+        buffer[length] = '\0';
+    }
+    else {
+        token.assign(begin, length);
+        text = token.c_str();
+    }
+
+    char * textEnd;
+    value = std::strtod(text, &textEnd);
+
+    return begin + (textEnd - text);
+}
+
+const char * parseReal(const char * begin, const char * end, double & value) {
+    const char * p = begin;
+    bool negative = false;
+
+    if (p != end && (*p == '-' || *p == '+')) {
+        negative = *p == '-';
+        p++;
+    }
+
+    uint64_t mantissa = 0;
+    int digitCount = 0, exponent = 0;
+    bool hasDigits = false;
+
+    while (p != end && isDigit(*p)) {
+        mantissa = mantissa * 10 + (*p - '0');
+
+        if (mantissa != 0)
+            digitCount++;
+
+        hasDigits = true;
+        p++;
+    }
+
+    if (p != end && *p == '.') {
+        p++;
+
+        while (p != end && isDigit(*p)) {
+            mantissa = mantissa * 10 + (*p - '0');
+
+            if (mantissa != 0)
+                digitCount++;
+
+            exponent--;
+            hasDigits = true;
+            p++;
+        }
+    }
+
+    // Mais de 19 algarismos significativos podem exceder 64 bits
+    if (!hasDigits || digitCount > 19)
+        return parseRealFallback(begin, end, value);
+
+    if (p != end && (*p == 'e' || *p == 'E')) {
+        const char * q = p + 1;
+        bool negativeExponent = false;
+
+        if (q != end && (*q == '-' || *q == '+')) {
+            negativeExponent = *q == '-';
+            q++;
+        }
+
+        if (q != end && isDigit(*q)) {
+            int e = 0;
+
+            while (q != end && isDigit(*q)) {
+                if (e < 10000)
+                    e = e * 10 + (*q - '0');
+
+                q++;
+            }
+
+            exponent += negativeExponent ? -e : e;
+            p = q;
+        }
+    }
+
+    if (mantissa == 0) {
+        value = negative ? -0.0 : 0.0;
+        return p;
+    }
+
+    // Caminho rápido de Clinger: mantissa e potência exatas resultam em uma única operação arredondada
+    if (mantissa <= (UINT64_C(1) << 53) && exponent >= -22 && exponent <= 22) {
+        double result = (double)mantissa;
+
+        if (exponent < 0)
+            result /= exactPowersOfTen[-exponent];
+        else
+            result *= exactPowersOfTen[exponent];
+
+        value = negative ? -result : result;
+
+        return p;
+    }
+
+    return parseRealFallback(begin, end, value);
+}
+const char * parseInteger(const char * begin, const char * end, size_t & value) {
+    size_t result = 0;
+
+    while (begin != end && isDigit(*begin)) {
+        result = result * 10 + (*begin - '0');
+        begin++;
+    }
+
+    value = result;
+
+    return begin;
+}
+
+// Número real em ponto flutuante estendido "f * 2^e" com mantissa de 64 bits
+struct ExtendedReal {
+    uint64_t f; // Mantissa
+    int e; // Expoente binário
+
+    ExtendedReal() : f(0), e(0) {}
+    ExtendedReal(uint64_t f, int e) : f(f), e(e) {}
+
+    // Retorna diferença entre números de mesmo expoente
+    ExtendedReal operator -(const ExtendedReal & rhs) const {
+        return ExtendedReal(f - rhs.f, e);
+    }
+    // Retorna produto com os 64 bits mais significativos arredondados
+    ExtendedReal operator *(const ExtendedReal & rhs) const {
+        uint64_t a = f >> 32, b = f & 0xFFFFFFFF;
+        uint64_t c = rhs.f >> 32, d = rhs.f & 0xFFFFFFFF;
+
+        uint64_t ac = a * c, bc = b * c, ad = a * d, bd = b * d;
+        uint64_t middle = (bd >> 32) + (ad & 0xFFFFFFFF) + (bc & 0xFFFFFFFF) + (UINT64_C(1) << 31);
+
+        return ExtendedReal(ac + (ad >> 32) + (bc >> 32) + (middle >> 32), e + rhs.e + 64);
+    }
+
+    // Desloca mantissa até o bit mais significativo
+    ExtendedReal normalized() const {
+        ExtendedReal x(*this);
+
+        while ((x.f >> 63) == 0) {
+            x.f <<= 1;
+            x.e--;
+        }
+
+        return x;
+    }
+};
+
+// Aproximação "f * 2^e" de 10^k com mantissa normalizada
+struct CachedPower {
+    uint64_t f;
+    int e;
+    int k;
+};
+
+// Potências de 10 de 10^-300 a 10^324 em passos de 10^8
+static const CachedPower cachedPowers[] = {
+    { UINT64_C(0xAB70FE17C79AC6CA), -1060, -300 },
+    { UINT64_C(0xFF77B1FCBEBCDC4F), -1034, -292 },
+    { UINT64_C(0xBE5691EF416BD60C), -1007, -284 },
+    { UINT64_C(0x8DD01FAD907FFC3C), -980, -276 },
+    { UINT64_C(0xD3515C2831559A83), -954, -268 },
+    { UINT64_C(0x9D71AC8FADA6C9B5), -927, -260 },
+    { UINT64_C(0xEA9C227723EE8BCB), -901, -252 },
+    { UINT64_C(0xAECC49914078536D), -874, -244 },
+    { UINT64_C(0x823C12795DB6CE57), -847, -236 },
+    { UINT64_C(0xC21094364DFB5637), -821, -228 },
+    { UINT64_C(0x9096EA6F3848984F), -794, -220 },
+    { UINT64_C(0xD77485CB25823AC7), -768, -212 },
+    { UINT64_C(0xA086CFCD97BF97F4), -741, -204 },
+    { UINT64_C(0xEF340A98172AACE5), -715, -196 },
+    { UINT64_C(0xB23867FB2A35B28E), -688, -188 },
+    { UINT64_C(0x84C8D4DFD2C63F3B), -661, -180 },
+    { UINT64_C(0xC5DD44271AD3CDBA), -635, -172 },
+    { UINT64_C(0x936B9FCEBB25C996), -608, -164 },
+    { UINT64_C(0xDBAC6C247D62A584), -582, -156 },
+    { UINT64_C(0xA3AB66580D5FDAF6), -555, -148 },
+    { UINT64_C(0xF3E2F893DEC3F126), -529, -140 },
+    { UINT64_C(0xB5B5ADA8AAFF80B8), -502, -132 },
+    { UINT64_C(0x87625F056C7C4A8B), -475, -124 },
+    { UINT64_C(0xC9BCFF6034C13053), -449, -116 },
+    { UINT64_C(0x964E858C91BA2655), -422, -108 },
+    { UINT64_C(0xDFF9772470297EBD), -396, -100 },
+    { UINT64_C(0xA6DFBD9FB8E5B88F), -369, -92 },
+    { UINT64_C(0xF8A95FCF88747D94), -343, -84 },
+    { UINT64_C(0xB94470938FA89BCF), -316, -76 },
+    { UINT64_C(0x8A08F0F8BF0F156B), -289, -68 },
+    { UINT64_C(0xCDB02555653131B6), -263, -60 },
+    { UINT64_C(0x993FE2C6D07B7FAC), -236, -52 },
+    { UINT64_C(0xE45C10C42A2B3B06), -210, -44 },
+    { UINT64_C(0xAA242499697392D3), -183, -36 },
+    { UINT64_C(0xFD87B5F28300CA0E), -157, -28 },
+    { UINT64_C(0xBCE5086492111AEB), -130, -20 },
+    { UINT64_C(0x8CBCCC096F5088CC), -103, -12 },
+    { UINT64_C(0xD1B71758E219652C), -77, -4 },
+    { UINT64_C(0x9C40000000000000), -50, 4 },
+    { UINT64_C(0xE8D4A51000000000), -24, 12 },
+    { UINT64_C(0xAD78EBC5AC620000), 3, 20 },
+    { UINT64_C(0x813F3978F8940984), 30, 28 },
+    { UINT64_C(0xC097CE7BC90715B3), 56, 36 },
+    { UINT64_C(0x8F7E32CE7BEA5C70), 83, 44 },
+    { UINT64_C(0xD5D238A4ABE98068), 109, 52 },
+    { UINT64_C(0x9F4F2726179A2245), 136, 60 },
+    { UINT64_C(0xED63A231D4C4FB27), 162, 68 },
+    { UINT64_C(0xB0DE65388CC8ADA8), 189, 76 },
+    { UINT64_C(0x83C7088E1AAB65DB), 216, 84 },
+    { UINT64_C(0xC45D1DF942711D9A), 242, 92 },
+    { UINT64_C(0x924D692CA61BE758), 269, 100 },
+    { UINT64_C(0xDA01EE641A708DEA), 295, 108 },
+    { UINT64_C(0xA26DA3999AEF774A), 322, 116 },
+    { UINT64_C(0xF209787BB47D6B85), 348, 124 },
+    { UINT64_C(0xB454E4A179DD1877), 375, 132 },
+    { UINT64_C(0x865B86925B9BC5C2), 402, 140 },
+    { UINT64_C(0xC83553C5C8965D3D), 428, 148 },
+    { UINT64_C(0x952AB45CFA97A0B3), 455, 156 },
+    { UINT64_C(0xDE469FBD99A05FE3), 481, 164 },
+    { UINT64_C(0xA59BC234DB398C25), 508, 172 },
+    { UINT64_C(0xF6C69A72A3989F5C), 534, 180 },
+    { UINT64_C(0xB7DCBF5354E9BECE), 561, 188 },
+    { UINT64_C(0x88FCF317F22241E2), 588, 196 },
+    { UINT64_C(0xCC20CE9BD35C78A5), 614, 204 },
+    { UINT64_C(0x98165AF37B2153DF), 641, 212 },
+    { UINT64_C(0xE2A0B5DC971F303A), 667, 220 },
+    { UINT64_C(0xA8D9D1535CE3B396), 694, 228 },
+    { UINT64_C(0xFB9B7CD9A4A7443C), 720, 236 },
+    { UINT64_C(0xBB764C4CA7A44410), 747, 244 },
+    { UINT64_C(0x8BAB8EEFB6409C1A), 774, 252 },
+    { UINT64_C(0xD01FEF10A657842C), 800, 260 },
+    { UINT64_C(0x9B10A4E5E9913129), 827, 268 },
+    { UINT64_C(0xE7109BFBA19C0C9D), 853, 276 },
+    { UINT64_C(0xAC2820D9623BF429), 880, 284 },
+    { UINT64_C(0x80444B5E7AA7CF85), 907, 292 },
+    { UINT64_C(0xBF21E44003ACDD2D), 933, 300 },
+    { UINT64_C(0x8E679C2F5E44FF8F), 960, 308 },
+    { UINT64_C(0xD433179D9C8CB841), 986, 316 },
+    { UINT64_C(0x9E19DB92B4E31BA9), 1013, 324 },
+};
+
+// Retorna maior potência de 10 menor ou igual a "n" e seu número de dígitos
+static int findLargestPowerOfTen(uint32_t n, uint32_t & powerOfTen) {
+    static const uint32_t powers[] = {
+        1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+    };
+
+    int digitCount = 10;
+
+    while (digitCount > 1 && n < powers[digitCount - 1])
+        digitCount--;
+
+    powerOfTen = powers[digitCount - 1];
+
+    return digitCount;
+}
+// Aproxima último dígito do valor exato dentro do intervalo de arredondamento
+static void roundShortestDigits(char * digits, int length, uint64_t distance,
+    uint64_t delta, uint64_t rest, uint64_t tenToK) {
+    while (rest < distance && delta - rest >= tenToK
+        && (rest + tenToK < distance || distance - rest > rest + tenToK - distance)) {
+        digits[length - 1]--;
+        rest += tenToK;
+    }
+}
+// Gera dígitos do menor número decimal no intervalo (algoritmo Grisu2 de Florian Loitsch; intervalo
+// de arredondamento de precisão simples se "singlePrecision" for verdadeiro)
+static int generateShortestDigits(char * digits, int & decimalExponent, double value,
+    bool singlePrecision) {
+    const int mantissaBits = singlePrecision ? 23 : 52;
+    const int exponentBias = (singlePrecision ? 127 : 1023) + mantissaBits;
+    const uint64_t hiddenBit = UINT64_C(1) << mantissaBits;
+
+    uint64_t bits;
+
+    if (singlePrecision) {
+        float single = (float)value;
+        uint32_t singleBits;
+
+        std::memcpy(&singleBits, &single, sizeof(float));
+        bits = singleBits;
+    }
+    else
+        std::memcpy(&bits, &value, sizeof(double));
+
+    uint64_t fraction = bits & (hiddenBit - 1);
+    int exponent = (int)((bits >> mantissaBits) & (singlePrecision ? 0xFF : 0x7FF));
+
+    ExtendedReal v = exponent == 0
+        ? ExtendedReal(fraction, 1 - exponentBias)
+        : ExtendedReal(fraction + hiddenBit, exponent - exponentBias);
+
+    // Limites do intervalo de números que arredondam para o mesmo valor
+    bool lowerBoundaryIsCloser = fraction == 0 && exponent > 1;
+
+    ExtendedReal plus = ExtendedReal(2 * v.f + 1, v.e - 1).normalized();
+    ExtendedReal minus = lowerBoundaryIsCloser
+        ? ExtendedReal(4 * v.f - 1, v.e - 2)
+        : ExtendedReal(2 * v.f - 1, v.e - 1);
+
+    minus = ExtendedReal(minus.f << (minus.e - plus.e), plus.e);
+    v = v.normalized();
+
+    // Potência de 10 que leva o expoente binário do produto ao intervalo [-60, -32]
+    int f = -60 - plus.e - 1;
+    int k = (f * 78913) / (1 << 18) + (f > 0 ? 1 : 0);
+
+    const CachedPower & cached = cachedPowers[(300 + k + 7) / 8];
+    ExtendedReal power(cached.f, cached.e);
+
+    ExtendedReal w = v * power;
+    ExtendedReal lower = minus * power;
+    ExtendedReal upper = plus * power;
+
+    lower.f++;
+    upper.f--;
+
+    decimalExponent = -cached.k;
+
+    uint64_t delta = (upper - lower).f;
+    uint64_t distance = (upper - w).f;
+
+    ExtendedReal one(UINT64_C(1) << -upper.e, upper.e);
+
+    uint32_t integral = (uint32_t)(upper.f >> -one.e);
+    uint64_t remainder = upper.f & (one.f - 1);
+
+    uint32_t powerOfTen;
+    int n = findLargestPowerOfTen(integral, powerOfTen);
+    int length = 0;
+
+    while (n > 0) {
+        digits[length++] = (char)('0' + integral / powerOfTen);
+        integral %= powerOfTen;
+        n--;
+
+        uint64_t rest = ((uint64_t)integral << -one.e) + remainder;
+
+        if (rest <= delta) {
+            decimalExponent += n;
+            roundShortestDigits(digits, length, distance, delta, rest, (uint64_t)powerOfTen << -one.e);
+
+            return length;
+        }
+
+        powerOfTen /= 10;
+    }
+
+    int m = 0;
+
+    while (true) {
+        remainder *= 10;
+
+        digits[length++] = (char)('0' + (remainder >> -one.e));
+        remainder &= one.f - 1;
+        m++;
+
+        delta *= 10;
+        distance *= 10;
+
+        if (remainder <= delta)
+            break;
+    }
+
+    decimalExponent -= m;
+    roundShortestDigits(digits, length, distance, delta, remainder, one.f);
+
+    return length;
+}
+// Formata número real com a menor quantidade de dígitos que preserva o valor na leitura
+static char * formatShortestReal(char * buffer, double value, bool singlePrecision) {
+    if (!std::isfinite(value))
+        return buffer + std::snprintf(buffer, CGC_REAL_TEXT_SIZE, "%.17g", value);
+
+    if (std::signbit(value))
+        *buffer++ = '-';
+
+    if (value == 0) {
+        *buffer++ = '0';
+        return buffer;
+    }
+
+    char digits[24];
+    int decimalExponent;
+    int length = generateShortestDigits(digits, decimalExponent, std::fabs(value), singlePrecision);
+
+    // Posição do ponto decimal em relação ao primeiro dígito
+    int point = length + decimalExponent;
+
+    if (length <= point && point <= 17) {
+        // Inteiro: dígitos seguidos de zeros
+        std::memcpy(buffer, digits, length);
+        std::memset(buffer + length, '0', point - length);
+
+        return buffer + point;
+    }
+
+    if (0 < point && point <= 17) {
+        // Ponto decimal entre os dígitos
+        std::memcpy(buffer, digits, point);
+        buffer[point] = '.';
+        std::memcpy(buffer + point + 1, digits + point, length - point);
+
+        return buffer + length + 1;
+    }
+
+    if (-6 < point && point <= 0) {
+        // Número menor que um: zeros após o ponto decimal
+        buffer[0] = '0';
+        buffer[1] = '.';
+        std::memset(buffer + 2, '0', -point);
+        std::memcpy(buffer + 2 - point, digits, length);
+
+        return buffer + 2 - point + length;
+    }
+
+    // Notação científica "d.ddde[+-]xx"
+    *buffer++ = digits[0];
+
+    if (length > 1) {
+        *buffer++ = '.';
+        std::memcpy(buffer, digits + 1, length - 1);
+        buffer += length - 1;
+    }
+
+    *buffer++ = 'e';
+    int exponent = point - 1;
+
+    if (exponent < 0) {
+        *buffer++ = '-';
+        exponent = -exponent;
+    }
+    else
+        *buffer++ = '+';
+
+    return formatInteger(buffer, (size_t)exponent);
+}
+
+char * formatReal(char * buffer, double value, int precision) {
+    if (precision < 0)
+        return formatShortestReal(buffer, value, false);
+
+    if (precision <= 17 && std::isfinite(value)) {
+        double scaled = std::fabs(value) * exactPowersOfTen[precision];
+
+        // Erro do produto fica abaixo de 2^-10 e só compromete valores próximos da metade
+        if (scaled < 8796093022208.0) {
+            double integral = std::floor(scaled);
+            double fraction = scaled - integral;
+
+            if (std::fabs(fraction - 0.5) > 1.0 / 512) {
+                uint64_t n = (uint64_t)integral + (fraction > 0.5 ? 1 : 0);
+                uint64_t powerOfTen = (uint64_t)exactPowersOfTen[precision];
+
+                if (std::signbit(value))
+                    *buffer++ = '-';
+
+                buffer = formatInteger(buffer, (size_t)(n / powerOfTen));
+
+                if (precision > 0) {
+                    uint64_t decimals = n % powerOfTen;
+                    *buffer++ = '.';
+
+                    for (int i = precision - 1; i >= 0; i--) {
+                        buffer[i] = (char)('0' + decimals % 10);
+                        decimals /= 10;
+                    }
+
+                    buffer += precision;
+                }
+
+                return buffer;
+            }
+        }
+    }
+
+    return buffer + std::snprintf(buffer, CGC_REAL_TEXT_SIZE, "%.*f", precision, value);
+}
+char * formatReal(char * buffer, float value, int precision) {
+    if (precision < 0)
+        return formatShortestReal(buffer, value, true);
+
+    return formatReal(buffer, (double)value, precision);
+}
+char * formatInteger(char * buffer, size_t value) {
+    char digits[24];
+    int length = 0;
+
+    do {
+        digits[length++] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+
+    while (length > 0)
+        *buffer++ = digits[--length];
+
+    return buffer;
+}
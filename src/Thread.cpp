@@ -0,0 +1,154 @@
+// File:    Thread.cpp
+// Author:  Danilo Peixoto
+// Date:    16/10/2026
+
+#include <Thread.h>
+
+#include <atomic>
+#include <memory>
+#include <algorithm>
+
+ThreadPool threadPool;
+
+// Estado compartilhado de uma execução paralela
+struct ThreadBatch {
+    const std::function<void(size_t)> * function; // Função executada por índice
+    size_t count; // Número total de índices
+    std::atomic<size_t> next; // Próximo índice disponível
+    std::atomic<size_t> completed; // Número de índices concluídos
+    std::mutex mutex; // Exclusão mútua da sinalização de término
+    std::condition_variable condition; // Sinalização de término
+
+    // Executa índices disponíveis até esgotar o lote
+    void process() {
+        size_t i;
+
+        while ((i = next++) < count) {
+            (*function)(i);
+
+            if (++completed == count) {
+                std::lock_guard<std::mutex> lock(mutex);
+                condition.notify_all();
+            }
+        }
+    }
+};
+
+void ThreadPool::work() {
+    while (true) {
+        std::function<void()> task;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            condition.wait(lock, [this]() { return !running || !tasks.empty(); });
+
+            if (!running && tasks.empty())
+                return;
+
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        }
+
+        task();
+    }
+}
+ThreadPool & ThreadPool::start() {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (!running) {
+        running = true;
+
+        // Thread que solicita a execução também processa tarefas
+        for (size_t i = 1; i < threadCount; i++)
+            threads.push_back(std::thread(&ThreadPool::work, this));
+    }
+
+    return *this;
+}
+
+ThreadPool::ThreadPool(size_t threadCount)
+    : threadCount(threadCount ? threadCount : getHardwareThreadCount()), running(false) {}
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        running = false;
+    }
+
+    condition.notify_all();
+
+    for (size_t i = 0; i < threads.size(); i++)
+        threads[i].join();
+}
+
+size_t ThreadPool::getThreadCount() const {
+    return threadCount;
+}
+
+ThreadPool & ThreadPool::run(size_t count, const std::function<void(size_t)> & function,
+    size_t threadCount) {
+    if (threadCount == 0 || threadCount > this->threadCount)
+        threadCount = this->threadCount;
+
+    size_t helperCount = std::min(threadCount, count);
+    helperCount = helperCount ? helperCount - 1 : 0;
+
+    if (helperCount == 0) {
+        for (size_t i = 0; i < count; i++)
+            function(i);
+
+        return *this;
+    }
+
+    start();
+
+    std::shared_ptr<ThreadBatch> batch = std::make_shared<ThreadBatch>();
+    batch->function = &function;
+    batch->count = count;
+    batch->next = 0;
+    batch->completed = 0;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        for (size_t i = 0; i < helperCount; i++)
+            tasks.push_back([batch]() { batch->process(); });
+    }
+
+    if (helperCount == 1)
+        condition.notify_one();
+    else
+        condition.notify_all();
+
+    batch->process();
+
+    std::unique_lock<std::mutex> lock(batch->mutex);
+    batch->condition.wait(lock, [&batch]() { return batch->completed == batch->count; });
+
+    return *this;
+}
+ThreadPool & ThreadPool::run(size_t begin, size_t end, size_t grainSize,
+    const std::function<void(size_t, size_t)> & function, size_t threadCount) {
+    if (begin >= end)
+        return *this;
+
+    if (threadCount == 0 || threadCount > this->threadCount)
+        threadCount = this->threadCount;
+
+    size_t size = end - begin;
+    grainSize = std::max(grainSize, (size_t)1);
+
+    // Blocos extras por thread equilibram cargas de trabalho irregulares
+    size_t blockCount = std::min((size + grainSize - 1) / grainSize, threadCount * 4);
+    size_t blockSize = (size + blockCount - 1) / blockCount;
+    blockCount = (size + blockSize - 1) / blockSize;
+
+    return run(blockCount, [&](size_t i) {
+        size_t blockBegin = begin + i * blockSize;
+        function(blockBegin, std::min(blockBegin + blockSize, end));
+    }, threadCount);
+}
+
+size_t getHardwareThreadCount() {
+    size_t threadCount = std::thread::hardware_concurrency();
+    return threadCount ? threadCount : 1;
+}
@@ -1,215 +1,901 @@
-// File:    TriangleMesh.cpp
-// Author:  Danilo Peixoto
-// Date:    06/08/2018
-
-#include <TriangleMesh.h>
-#include <Vector.h>
-#include <Matrix.h>
-
-TriangleMesh::TriangleMesh() {}
-TriangleMesh::TriangleMesh(const TriangleMesh & triangleMesh) {
-    create(triangleMesh);
-}
-TriangleMesh::TriangleMesh(size_t vertexCount, size_t triangleCount,
-    size_t normalCount, size_t textureCoordinateCount) {
-    create(vertexCount, triangleCount, normalCount, textureCoordinateCount);
-}
-TriangleMesh::TriangleMesh(
-    const std::vector<Vector3> & vertices,
-    const std::vector<size_t> & vertexIndices) {
-    create(vertices, vertexIndices);
-}
-TriangleMesh::TriangleMesh(
-    const std::vector<Vector3> & vertices,
-    const std::vector<Vector3> & normals,
-    const std::vector<Vector2> & textureCoordinates,
-    const std::vector<size_t> & vertexIndices,
-    const std::vector<size_t> & normalIndices,
-    const std::vector<size_t> & textureIndices) {
-    create(vertices, normals, textureCoordinates,
-        vertexIndices, normalIndices, textureIndices);
-}
-TriangleMesh::~TriangleMesh() {}
-
-bool TriangleMesh::operator ==(const TriangleMesh & rhs) const {
-    return vertices == rhs.vertices
-        && normals == rhs.normals
-        && textureCoordinates == rhs.textureCoordinates
-        && vertexIndices == rhs.vertexIndices
-        && normalIndices == rhs.normalIndices
-        && textureIndices == rhs.textureIndices;
-}
-bool TriangleMesh::operator !=(const TriangleMesh & rhs) const {
-    return !(*this == rhs);
-}
-std::ostream & operator <<(std::ostream & lhs, const TriangleMesh & rhs) {
-    return lhs << "Vertices: " << rhs.getVertexCount() << std::endl
-        << "Triangles: " << rhs.getTriangleCount() << std::endl
-        << "Normals: " << rhs.getNormalCount() << std::endl
-        << "Texture coordinates: " << rhs.getTextureCoordinateCount();
-}
-
-TriangleMesh & TriangleMesh::setVertex(size_t i, const Vector3 & vertex) {
-    vertices[i] = vertex;
-    return *this;
-}
-TriangleMesh & TriangleMesh::setNormal(size_t i, const Vector3 & normal) {
-    normals[i] = normal;
-    return *this;
-}
-TriangleMesh & TriangleMesh::setTextureCoordinates(size_t i, const Vector2 & textureCoordinates) {
-    this->textureCoordinates[i] = textureCoordinates;
-    return *this;
-}
-TriangleMesh & TriangleMesh::setVertexIndices(size_t i, size_t v0, size_t v1, size_t v2) {
-    vertexIndices[i * 3] = v0;
-    vertexIndices[i * 3 + 1] = v1;
-    vertexIndices[i * 3 + 2] = v2;
-
-    return *this;
-}
-TriangleMesh & TriangleMesh::setNormalIndices(size_t i, size_t v0, size_t v1, size_t v2) {
-    normalIndices[i * 3] = v0;
-    normalIndices[i * 3 + 1] = v1;
-    normalIndices[i * 3 + 2] = v2;
-
-    return *this;
-}
-TriangleMesh & TriangleMesh::setTextureIndices(size_t i, size_t v0, size_t v1, size_t v2) {
-    textureIndices[i * 3] = v0;
-    textureIndices[i * 3 + 1] = v1;
-    textureIndices[i * 3 + 2] = v2;
-
-    return *this;
-}
-const std::vector<Vector3> & TriangleMesh::getVertices() const {
-    return vertices;
-}
-const std::vector<Vector3> & TriangleMesh::getNormals() const {
-    return normals;
-}
-const std::vector<Vector2> & TriangleMesh::getTextureCoordinates() const {
-    return textureCoordinates;
-}
-const std::vector<size_t> & TriangleMesh::getVertexIndices() const {
-    return vertexIndices;
-}
-const std::vector<size_t> & TriangleMesh::getNormalIndices() const {
-    return normalIndices;
-}
-const std::vector<size_t> & TriangleMesh::getTextureIndices() const {
-    return textureIndices;
-}
-const Vector3 & TriangleMesh::getVertex(size_t i) const {
-    return vertices[i];
-}
-const Vector3 & TriangleMesh::getNormal(size_t i) const {
-    return normals[i];
-}
-const Vector2 & TriangleMesh::getTextureCoordinates(size_t i) const {
-    return textureCoordinates[i];
-}
-void TriangleMesh::getVertexIndices(size_t i, size_t & v0, size_t & v1, size_t & v2) const {
-    v0 = vertexIndices[i * 3];
-    v1 = vertexIndices[i * 3 + 1];
-    v2 = vertexIndices[i * 3 + 2];
-}
-void TriangleMesh::getNormalIndices(size_t i, size_t & v0, size_t & v1, size_t & v2) const {
-    v0 = normalIndices[i * 3];
-    v1 = normalIndices[i * 3 + 1];
-    v2 = normalIndices[i * 3 + 2];
-}
-void TriangleMesh::getTextureIndices(size_t i, size_t & v0, size_t & v1, size_t & v2) const {
-    v0 = textureIndices[i * 3];
-    v1 = textureIndices[i * 3 + 1];
-    v2 = textureIndices[i * 3 + 2];
-}
-size_t TriangleMesh::getVertexCount() const {
-    return vertices.size();
-}
-size_t TriangleMesh::getNormalCount() const {
-    return normals.size();
-}
-size_t TriangleMesh::getTextureCoordinateCount() const {
-    return textureCoordinates.size();
-}
-size_t TriangleMesh::getTriangleCount() const {
-    return vertexIndices.size() / 3;
-}
-bool TriangleMesh::hasNormals() const {
-    return !normalIndices.empty();
-}
-bool TriangleMesh::hasTextureCoordinates() const {
-    return !textureIndices.empty();
-}
-
-TriangleMesh & TriangleMesh::create(const TriangleMesh & triangleMesh) {
-    vertices = triangleMesh.vertices;
-    normals = triangleMesh.normals;
-    textureCoordinates = triangleMesh.textureCoordinates;
-    vertexIndices = triangleMesh.vertexIndices;
-    normalIndices = triangleMesh.normalIndices;
-    textureIndices = triangleMesh.textureIndices;
-
-    return *this;
-}
-TriangleMesh & TriangleMesh::create(
-    size_t vertexCount, size_t triangleCount,
-    size_t normalCount, size_t textureCoordinateCount) {
-    vertices.resize(vertexCount);
-    normals.resize(normalCount);
-    textureCoordinates.resize(textureCoordinateCount);
-
-    size_t size = triangleCount * 3;
-
-    vertexIndices.resize(size);
-    normalIndices.resize(normalCount ? size : 0);
-    textureIndices.resize(textureCoordinateCount ? size : 0);
-
-    return *this;
-}
-TriangleMesh & TriangleMesh::create(
-    const std::vector<Vector3> & vertices,
-    const std::vector<size_t> & vertexIndices) {
-    this->vertices = vertices;
-    this->vertexIndices = vertexIndices;
-
-    normals.clear();
-    textureCoordinates.clear();
-    normalIndices.clear();
-    textureIndices.clear();
-
-    return *this;
-}
-TriangleMesh & TriangleMesh::create(
-    const std::vector<Vector3> & vertices,
-    const std::vector<Vector3> & normals,
-    const std::vector<Vector2> & textureCoordinates,
-    const std::vector<size_t> & vertexIndices,
-    const std::vector<size_t> & normalIndices,
-    const std::vector<size_t> & textureIndices) {
-    this->vertices = vertices;
-    this->normals = normals;
-    this->textureCoordinates = textureCoordinates;
-    this->vertexIndices = vertexIndices;
-    this->normalIndices = normalIndices;
-    this->textureIndices = textureIndices;
-
-    return *this;
-}
-
-TriangleMesh & TriangleMesh::transform(const Matrix4 & transformation) {
-    for (size_t i = 0; i < getVertexCount(); i++)
-        vertices[i] *= transformation;
-
-    if (hasNormals()) {
-        Matrix4 normalTransformation = transformation.inverse().transpose();
-
-        for (size_t i = 0; i < getNormalCount(); i++) {
-            normals[i] *= normalTransformation;
-            normals[i].normalize();
-        }
-    }
-
-    return *this;
-}
\ No newline at end of file
+// File:    TriangleMesh.cpp
+// Author:  Danilo Peixoto
+// Date:    06/08/2018
+
+#include <TriangleMesh.h>
+#include <Vector.h>
+#include <Matrix.h>
+#include <Global.h>
+#include <Thread.h>
+
+#include <utility>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// Instruções SSE2 estão disponíveis em todos processadores x86 de 64 bits (AVX somente quando habilitado
+// na compilação)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CGC_SSE2
+#include <emmintrin.h>
+#endif
+#ifdef __AVX__
+#define CGC_AVX
+#include <immintrin.h>
+#endif
+
+// Vetores por bloco de trabalho da transformação paralela
+static const size_t transformBlockSize = 1 << 14;
+
+// Listas de vetores são transformadas como listas contíguas de componentes
+static_assert(sizeof(Vector3) == 3 * sizeof(double), "Vector3 must be tightly packed");
+static_assert(sizeof(Vector3f) == 3 * sizeof(float), "Vector3f must be tightly packed");
+
+// Converte lista de vetores entre precisões (construção explícita elemento a elemento)
+template<typename Source, typename Target>
+static void convertVectors(const std::vector<Source> & source, std::vector<Target> & target) {
+    std::vector<Target>(source.begin(), source.end()).swap(target);
+}
+// Move cada elemento da lista para sua nova posição (elemento "i" passa à posição "remap[i]")
+template<typename T>
+static void remapVectors(std::vector<T> & values, const std::vector<size_t> & remap) {
+    std::vector<T> result(values.size());
+
+    for (size_t i = 0; i < values.size(); i++)
+        result[remap[i]] = values[i];
+
+    values.swap(result);
+}
+// Normaliza vetor de precisão dupla (mesmas operações de "Vector3::normalize")
+static inline void normalizeVector(double * v) {
+    double l2 = v[0] * v[0] + v[1] * v[1] + v[2] * v[2];
+
+    if (l2 > CGC_EPSILON) {
+        double l = std::sqrt(l2);
+
+        v[0] /= l;
+        v[1] /= l;
+        v[2] /= l;
+    }
+}
+// Normaliza vetor de precisão simples (mesmas operações de "Vector3f::normalize")
+static inline void normalizeVector(float * v) {
+    float l2 = v[0] * v[0] + v[1] * v[1] + v[2] * v[2];
+
+    if (l2 > CGC_EPSILON) {
+        float s = 1.0f / std::sqrt(l2);
+
+        v[0] *= s;
+        v[1] *= s;
+        v[2] *= s;
+    }
+}
+// Transforma vetores um a um (componentes consecutivas e matriz 4x3 com translação na última linha)
+template<typename Real>
+static void transformScalar(Real * values, size_t count, const Real (&m)[4][3], bool isNormal) {
+    for (size_t i = 0; i < count; i++, values += 3) {
+        Real x = values[0], y = values[1], z = values[2];
+
+        values[0] = x * m[0][0] + y * m[1][0] + z * m[2][0] + m[3][0];
+        values[1] = x * m[0][1] + y * m[1][1] + z * m[2][1] + m[3][1];
+        values[2] = x * m[0][2] + y * m[1][2] + z * m[2][2] + m[3][2];
+
+        if (isNormal)
+            normalizeVector(values);
+    }
+}
+
+#ifdef CGC_SSE2
+static inline __m128d add(__m128d a, __m128d b) { return _mm_add_pd(a, b); }
+static inline __m128d mul(__m128d a, __m128d b) { return _mm_mul_pd(a, b); }
+static inline __m128 add(__m128 a, __m128 b) { return _mm_add_ps(a, b); }
+static inline __m128 mul(__m128 a, __m128 b) { return _mm_mul_ps(a, b); }
+
+// Normaliza dois vetores de precisão dupla em componentes separadas
+static inline void normalizePacket(__m128d & x, __m128d & y, __m128d & z) {
+    __m128d l2 = _mm_add_pd(_mm_add_pd(_mm_mul_pd(x, x), _mm_mul_pd(y, y)), _mm_mul_pd(z, z));
+    __m128d mask = _mm_cmpgt_pd(l2, _mm_set1_pd(CGC_EPSILON));
+    __m128d l = _mm_sqrt_pd(l2);
+
+    x = _mm_or_pd(_mm_and_pd(mask, _mm_div_pd(x, l)), _mm_andnot_pd(mask, x));
+    y = _mm_or_pd(_mm_and_pd(mask, _mm_div_pd(y, l)), _mm_andnot_pd(mask, y));
+    z = _mm_or_pd(_mm_and_pd(mask, _mm_div_pd(z, l)), _mm_andnot_pd(mask, z));
+}
+// Normaliza quatro vetores de precisão simples em componentes separadas
+static inline void normalizePacket(__m128 & x, __m128 & y, __m128 & z) {
+    __m128 l2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z));
+    __m128 mask = _mm_cmpgt_ps(l2, _mm_set1_ps((float)CGC_EPSILON));
+    __m128 s = _mm_and_ps(mask, _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(l2)));
+
+    x = _mm_or_ps(_mm_mul_ps(x, s), _mm_andnot_ps(mask, x));
+    y = _mm_or_ps(_mm_mul_ps(y, s), _mm_andnot_ps(mask, y));
+    z = _mm_or_ps(_mm_mul_ps(z, s), _mm_andnot_ps(mask, z));
+}
+#endif
+
+#ifdef CGC_AVX
+static inline __m256d add(__m256d a, __m256d b) { return _mm256_add_pd(a, b); }
+static inline __m256d mul(__m256d a, __m256d b) { return _mm256_mul_pd(a, b); }
+
+// Normaliza quatro vetores de precisão dupla em componentes separadas
+static inline void normalizePacket(__m256d & x, __m256d & y, __m256d & z) {
+    __m256d l2 = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(x, x), _mm256_mul_pd(y, y)), _mm256_mul_pd(z, z));
+    __m256d mask = _mm256_cmp_pd(l2, _mm256_set1_pd(CGC_EPSILON), _CMP_GT_OQ);
+    __m256d l = _mm256_sqrt_pd(l2);
+
+    x = _mm256_blendv_pd(x, _mm256_div_pd(x, l), mask);
+    y = _mm256_blendv_pd(y, _mm256_div_pd(y, l), mask);
+    z = _mm256_blendv_pd(z, _mm256_div_pd(z, l), mask);
+}
+#endif
+
+#if defined(CGC_SSE2) || defined(CGC_AVX)
+// Transforma pacote de vetores em componentes separadas (mesma ordem de operações da versão escalar)
+template<typename Packet>
+static inline void transformPacket(Packet & x, Packet & y, Packet & z, const Packet (&m)[4][3], bool isNormal) {
+    Packet u = add(add(add(mul(x, m[0][0]), mul(y, m[1][0])), mul(z, m[2][0])), m[3][0]);
+    Packet v = add(add(add(mul(x, m[0][1]), mul(y, m[1][1])), mul(z, m[2][1])), m[3][1]);
+    Packet w = add(add(add(mul(x, m[0][2]), mul(y, m[1][2])), mul(z, m[2][2])), m[3][2]);
+
+    x = u;
+    y = v;
+    z = w;
+
+    if (isNormal)
+        normalizePacket(x, y, z);
+}
+#endif
+
+// Transforma vetores de precisão dupla (pacotes de quatro vetores com AVX ou dois com SSE2)
+static void transformValues(double * values, size_t count, const double (&m)[4][3], bool isNormal) {
+#if defined(CGC_AVX)
+    __m256d rows[4][3];
+
+    for (size_t i = 0; i < 4; i++) {
+        for (size_t j = 0; j < 3; j++)
+            rows[i][j] = _mm256_set1_pd(m[i][j]);
+    }
+
+    // Três registros (x0 y0 z0 x1), (y1 z1 x2 y2) e (z2 x3 y3 z3) são transpostos em componentes separadas
+    for (; count >= 4; count -= 4, values += 12) {
+        __m256d a = _mm256_loadu_pd(values), b = _mm256_loadu_pd(values + 4), c = _mm256_loadu_pd(values + 8);
+        __m256d p = _mm256_permute2f128_pd(a, b, 0x30);
+        __m256d q = _mm256_permute2f128_pd(a, c, 0x21);
+        __m256d r = _mm256_permute2f128_pd(b, c, 0x30);
+        __m256d x = _mm256_shuffle_pd(p, q, 0xA), y = _mm256_shuffle_pd(p, r, 0x5), z = _mm256_shuffle_pd(q, r, 0xA);
+
+        transformPacket(x, y, z, rows, isNormal);
+
+        p = _mm256_shuffle_pd(x, y, 0x0);
+        q = _mm256_shuffle_pd(z, x, 0xA);
+        r = _mm256_shuffle_pd(y, z, 0xF);
+
+        _mm256_storeu_pd(values, _mm256_permute2f128_pd(p, q, 0x20));
+        _mm256_storeu_pd(values + 4, _mm256_permute2f128_pd(r, p, 0x30));
+        _mm256_storeu_pd(values + 8, _mm256_permute2f128_pd(q, r, 0x31));
+    }
+#elif defined(CGC_SSE2)
+    __m128d rows[4][3];
+
+    for (size_t i = 0; i < 4; i++) {
+        for (size_t j = 0; j < 3; j++)
+            rows[i][j] = _mm_set1_pd(m[i][j]);
+    }
+
+    // Três registros (x0 y0), (z0 x1) e (y1 z1) são transpostos em componentes separadas
+    for (; count >= 2; count -= 2, values += 6) {
+        __m128d a = _mm_loadu_pd(values), b = _mm_loadu_pd(values + 2), c = _mm_loadu_pd(values + 4);
+        __m128d x = _mm_shuffle_pd(a, b, 2), y = _mm_shuffle_pd(a, c, 1), z = _mm_shuffle_pd(b, c, 2);
+
+        transformPacket(x, y, z, rows, isNormal);
+
+        _mm_storeu_pd(values, _mm_shuffle_pd(x, y, 0));
+        _mm_storeu_pd(values + 2, _mm_shuffle_pd(z, x, 2));
+        _mm_storeu_pd(values + 4, _mm_shuffle_pd(y, z, 3));
+    }
+#endif
+
+    transformScalar(values, count, m, isNormal);
+}
+// Transforma vetores de precisão simples (pacotes de quatro vetores com SSE2)
+static void transformValues(float * values, size_t count, const float (&m)[4][3], bool isNormal) {
+#ifdef CGC_SSE2
+    __m128 rows[4][3];
+
+    for (size_t i = 0; i < 4; i++) {
+        for (size_t j = 0; j < 3; j++)
+            rows[i][j] = _mm_set1_ps(m[i][j]);
+    }
+
+    // Três registros (x0 y0 z0 x1), (y1 z1 x2 y2) e (z2 x3 y3 z3) são transpostos em componentes separadas
+    for (; count >= 4; count -= 4, values += 12) {
+        __m128 a = _mm_loadu_ps(values), b = _mm_loadu_ps(values + 4), c = _mm_loadu_ps(values + 8);
+        __m128 u = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 1, 3, 2));
+        __m128 v = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 0, 2, 1));
+        __m128 x = _mm_shuffle_ps(a, u, _MM_SHUFFLE(2, 0, 3, 0));
+        __m128 y = _mm_shuffle_ps(v, u, _MM_SHUFFLE(3, 1, 2, 0));
+        __m128 z = _mm_shuffle_ps(v, c, _MM_SHUFFLE(3, 0, 3, 1));
+
+        transformPacket(x, y, z, rows, isNormal);
+
+        __m128 low = _mm_unpacklo_ps(x, y), high = _mm_unpackhi_ps(x, y);
+        u = _mm_shuffle_ps(z, low, _MM_SHUFFLE(3, 2, 1, 0));
+        v = _mm_shuffle_ps(z, high, _MM_SHUFFLE(3, 2, 3, 2));
+
+        _mm_storeu_ps(values, _mm_shuffle_ps(low, u, _MM_SHUFFLE(2, 0, 1, 0)));
+        _mm_storeu_ps(values + 4, _mm_shuffle_ps(u, high, _MM_SHUFFLE(1, 0, 1, 3)));
+        _mm_storeu_ps(values + 8, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 3, 2, 0)));
+    }
+#endif
+
+    transformScalar(values, count, m, isNormal);
+}
+// Transforma lista de vetores em blocos paralelos (matriz convertida uma única vez para a precisão dos
+// vetores; vetores normais não sofrem translação e são normalizados)
+template<typename Real, typename Vector>
+static void transformVectors(std::vector<Vector> & vectors, const Matrix4 & transformation, bool isNormal,
+    size_t threadCount) {
+    Real m[4][3];
+
+    for (size_t i = 0; i < 4; i++) {
+        for (size_t j = 0; j < 3; j++)
+            m[i][j] = (Real)transformation[i][j];
+    }
+
+    if (isNormal)
+        m[3][0] = m[3][1] = m[3][2] = 0;
+
+    Real * values = vectors.empty() ? nullptr : &vectors[0].x;
+
+    threadPool.run(0, vectors.size(), transformBlockSize, [&](size_t begin, size_t end) {
+        transformValues(values + begin * 3, end - begin, m, isNormal);
+    }, threadCount);
+}
+
+// Retorna matriz de transformação de vetores normais (transposta da inversa)
+static Matrix4 getNormalTransformation(const Matrix4 & transformation) {
+    return (transformation.isAffine() ? transformation.affineInverse() : transformation.inverse()).transpose();
+}
+// Transforma volumes envolventes ampliados pela margem de arredondamento dos vértices transformados
+// (tolerância relativa à soma absoluta dos termos de cada componente)
+static void transformBounds(BoundingBox & boundingBox, BoundingSphere & boundingSphere,
+    const Matrix4 & transformation, double tolerance) {
+    if (boundingBox.isEmpty())
+        return;
+
+    Vector3 margin;
+
+    for (size_t j = 0; j < 3; j++) {
+        margin[j] = std::abs(transformation[3][j]);
+
+        for (size_t i = 0; i < 3; i++) {
+            margin[j] += std::max(std::abs(boundingBox.minimum[i]), std::abs(boundingBox.maximum[i]))
+                * std::abs(transformation[i][j]);
+        }
+
+        margin[j] *= tolerance;
+    }
+
+    boundingBox.transform(transformation);
+    boundingSphere.transform(transformation);
+
+    boundingBox.minimum -= margin;
+    boundingBox.maximum += margin;
+    boundingSphere.radius += margin.length() * 2.0 + boundingSphere.radius * tolerance;
+}
+
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::TriangleMeshBase() : boundsValid(false) {}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::TriangleMeshBase(size_t vertexCount, size_t triangleCount,
+    size_t normalCount, size_t textureCoordinateCount) {
+    create(vertexCount, triangleCount, normalCount, textureCoordinateCount);
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::TriangleMeshBase(
+    const std::vector<Vector3Type> & vertices,
+    const std::vector<size_t> & vertexIndices) {
+    create(vertices, vertexIndices);
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::TriangleMeshBase(
+    std::vector<Vector3Type> && vertices,
+    std::vector<size_t> && vertexIndices) {
+    create(std::move(vertices), std::move(vertexIndices));
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::TriangleMeshBase(
+    const std::vector<Vector3Type> & vertices,
+    const std::vector<Vector3Type> & normals,
+    const std::vector<Vector2Type> & textureCoordinates,
+    const std::vector<size_t> & vertexIndices,
+    const std::vector<size_t> & normalIndices,
+    const std::vector<size_t> & textureIndices) {
+    create(vertices, normals, textureCoordinates,
+        vertexIndices, normalIndices, textureIndices);
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::TriangleMeshBase(
+    std::vector<Vector3Type> && vertices,
+    std::vector<Vector3Type> && normals,
+    std::vector<Vector2Type> && textureCoordinates,
+    std::vector<size_t> && vertexIndices,
+    std::vector<size_t> && normalIndices,
+    std::vector<size_t> && textureIndices) {
+    create(std::move(vertices), std::move(normals), std::move(textureCoordinates),
+        std::move(vertexIndices), std::move(normalIndices), std::move(textureIndices));
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::TriangleMeshBase(
+    std::vector<Vector3Type> && vertices,
+    std::vector<Vector3Type> && normals,
+    std::vector<Vector2Type> && textureCoordinates,
+    IndexBuffer && vertexIndices,
+    IndexBuffer && normalIndices,
+    IndexBuffer && textureIndices) {
+    create(std::move(vertices), std::move(normals), std::move(textureCoordinates),
+        std::move(vertexIndices), std::move(normalIndices), std::move(textureIndices));
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::~TriangleMeshBase() {}
+
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+bool TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::operator ==(const Mesh & rhs) const {
+    return vertices == rhs.vertices
+        && normals == rhs.normals
+        && textureCoordinates == rhs.textureCoordinates
+        && vertexIndices == rhs.vertexIndices
+        && normalIndices == rhs.normalIndices
+        && textureIndices == rhs.textureIndices
+        && tangents == rhs.tangents
+        && bitangents == rhs.bitangents
+        && tangentIndices == rhs.tangentIndices;
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+bool TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::operator !=(const Mesh & rhs) const {
+    return !(*this == rhs);
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+Mesh & TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::setVertex(size_t i, const Vector3Type & vertex) {
+    vertices[i] = vertex;
+    // Invalidação sem barreira de memória mantém barata a configuração de muitos vértices
+    boundsValid.store(false, std::memory_order_relaxed);
+
+    return static_cast<Mesh &>(*this);
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+Mesh & TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::setNormal(size_t i, const Vector3Type & normal) {
+    normals[i] = normal;
+    return static_cast<Mesh &>(*this);
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+Mesh & TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::setTextureCoordinates(
+    size_t i, const Vector2Type & textureCoordinates) {
+    this->textureCoordinates[i] = textureCoordinates;
+    return static_cast<Mesh &>(*this);
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+Mesh & TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::setVertexIndices(
+    size_t i, size_t v0, size_t v1, size_t v2) {
+    vertexIndices.set(i * 3, v0).set(i * 3 + 1, v1).set(i * 3 + 2, v2);
+
+    return static_cast<Mesh &>(*this);
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+Mesh & TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::setNormalIndices(
+    size_t i, size_t v0, size_t v1, size_t v2) {
+    normalIndices.set(i * 3, v0).set(i * 3 + 1, v1).set(i * 3 + 2, v2);
+
+    return static_cast<Mesh &>(*this);
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+Mesh & TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::setTextureIndices(
+    size_t i, size_t v0, size_t v1, size_t v2) {
+    textureIndices.set(i * 3, v0).set(i * 3 + 1, v1).set(i * 3 + 2, v2);
+
+    return static_cast<Mesh &>(*this);
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+Mesh & TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::setIndexWidth(size_t width) {
+    vertexIndices.setWidth(width);
+    normalIndices.setWidth(width);
+    textureIndices.setWidth(width);
+    tangentIndices.setWidth(width);
+
+    return static_cast<Mesh &>(*this);
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+Mesh & TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::setNormals(
+    std::vector<Vector3Type> && normals, IndexBuffer && normalIndices) {
+    this->normals = std::move(normals);
+    this->normalIndices = std::move(normalIndices);
+
+    // Tangentes foram geradas a partir dos vetores normais substituídos
+    clearTangents();
+
+    return static_cast<Mesh &>(*this);
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+Mesh & TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::setTangents(
+    std::vector<Vector3Type> && tangents, std::vector<Vector3Type> && bitangents,
+    IndexBuffer && tangentIndices) {
+    this->tangents = std::move(tangents);
+    this->bitangents = std::move(bitangents);
+    this->tangentIndices = std::move(tangentIndices);
+
+    return static_cast<Mesh &>(*this);
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+const std::vector<Vector3Type> & TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::getVertices() const {
+    return vertices;
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+const std::vector<Vector3Type> & TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::getNormals() const {
+    return normals;
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+const std::vector<Vector2Type> & TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::getTextureCoordinates() const {
+    return textureCoordinates;
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+const IndexBuffer & TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::getVertexIndices() const {
+    return vertexIndices;
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+const IndexBuffer & TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::getNormalIndices() const {
+    return normalIndices;
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+const IndexBuffer & TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::getTextureIndices() const {
+    return textureIndices;
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+const std::vector<Vector3Type> & TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::getTangents() const {
+    return tangents;
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+const std::vector<Vector3Type> & TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::getBitangents() const {
+    return bitangents;
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+const IndexBuffer & TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::getTangentIndices() const {
+    return tangentIndices;
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+const Vector3Type & TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::getVertex(size_t i) const {
+    return vertices[i];
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+const Vector3Type & TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::getNormal(size_t i) const {
+    return normals[i];
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+const Vector2Type & TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::getTextureCoordinates(size_t i) const {
+    return textureCoordinates[i];
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+const Vector3Type & TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::getTangent(size_t i) const {
+    return tangents[i];
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+const Vector3Type & TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::getBitangent(size_t i) const {
+    return bitangents[i];
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+void TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::getVertexIndices(
+    size_t i, size_t & v0, size_t & v1, size_t & v2) const {
+    vertexIndices.get(i * 3, v0, v1, v2);
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+void TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::getNormalIndices(
+    size_t i, size_t & v0, size_t & v1, size_t & v2) const {
+    normalIndices.get(i * 3, v0, v1, v2);
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+void TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::getTextureIndices(
+    size_t i, size_t & v0, size_t & v1, size_t & v2) const {
+    textureIndices.get(i * 3, v0, v1, v2);
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+void TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::getTangentIndices(
+    size_t i, size_t & v0, size_t & v1, size_t & v2) const {
+    tangentIndices.get(i * 3, v0, v1, v2);
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+size_t TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::getVertexCount() const {
+    return vertices.size();
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+size_t TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::getNormalCount() const {
+    return normals.size();
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+size_t TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::getTextureCoordinateCount() const {
+    return textureCoordinates.size();
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+size_t TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::getTangentCount() const {
+    return tangents.size();
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+size_t TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::getTriangleCount() const {
+    return vertexIndices.getSize() / 3;
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+bool TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::hasNormals() const {
+    return !normalIndices.isEmpty();
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+bool TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::hasTextureCoordinates() const {
+    return !textureIndices.isEmpty();
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+bool TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::hasTangents() const {
+    return !tangentIndices.isEmpty();
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+const BoundingBox & TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::getBoundingBox() const {
+    updateBounds();
+    return boundingBox;
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+const BoundingSphere & TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::getBoundingSphere() const {
+    updateBounds();
+    return boundingSphere;
+}
+
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+Mesh & TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::create(const Mesh & triangleMesh) {
+    vertices = triangleMesh.vertices;
+    normals = triangleMesh.normals;
+    textureCoordinates = triangleMesh.textureCoordinates;
+    vertexIndices = triangleMesh.vertexIndices;
+    normalIndices = triangleMesh.normalIndices;
+    textureIndices = triangleMesh.textureIndices;
+    tangents = triangleMesh.tangents;
+    bitangents = triangleMesh.bitangents;
+    tangentIndices = triangleMesh.tangentIndices;
+
+    copyBounds(triangleMesh);
+
+    return static_cast<Mesh &>(*this);
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+Mesh & TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::create(Mesh && triangleMesh) {
+    if (this != &triangleMesh) {
+        vertices = std::move(triangleMesh.vertices);
+        normals = std::move(triangleMesh.normals);
+        textureCoordinates = std::move(triangleMesh.textureCoordinates);
+        vertexIndices = std::move(triangleMesh.vertexIndices);
+        normalIndices = std::move(triangleMesh.normalIndices);
+        textureIndices = std::move(triangleMesh.textureIndices);
+        tangents = std::move(triangleMesh.tangents);
+        bitangents = std::move(triangleMesh.bitangents);
+        tangentIndices = std::move(triangleMesh.tangentIndices);
+
+        copyBounds(triangleMesh);
+
+        triangleMesh.vertices.clear();
+        triangleMesh.normals.clear();
+        triangleMesh.textureCoordinates.clear();
+        triangleMesh.tangents.clear();
+        triangleMesh.bitangents.clear();
+        triangleMesh.boundsValid = false;
+    }
+
+    return static_cast<Mesh &>(*this);
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+Mesh & TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::create(
+    size_t vertexCount, size_t triangleCount,
+    size_t normalCount, size_t textureCoordinateCount) {
+    vertices.resize(vertexCount);
+    normals.resize(normalCount);
+    textureCoordinates.resize(textureCoordinateCount);
+
+    size_t size = triangleCount * 3;
+
+    // Largura dos índices é escolhida pelo número de atributos referenciados
+    vertexIndices = IndexBuffer(size, vertexCount ? vertexCount - 1 : 0);
+    normalIndices = IndexBuffer(normalCount ? size : 0, normalCount ? normalCount - 1 : 0);
+    textureIndices = IndexBuffer(textureCoordinateCount ? size : 0,
+        textureCoordinateCount ? textureCoordinateCount - 1 : 0);
+
+    clearTangents();
+
+    boundsValid = false;
+
+    return static_cast<Mesh &>(*this);
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+Mesh & TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::create(
+    const std::vector<Vector3Type> & vertices,
+    const std::vector<size_t> & vertexIndices) {
+    this->vertices = vertices;
+    this->vertexIndices = IndexBuffer(vertexIndices);
+
+    normals.clear();
+    textureCoordinates.clear();
+    normalIndices.clear();
+    textureIndices.clear();
+    clearTangents();
+
+    boundsValid = false;
+
+    return static_cast<Mesh &>(*this);
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+Mesh & TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::create(
+    std::vector<Vector3Type> && vertices,
+    std::vector<size_t> && vertexIndices) {
+    this->vertices = std::move(vertices);
+    this->vertexIndices = IndexBuffer(std::move(vertexIndices));
+
+    normals.clear();
+    textureCoordinates.clear();
+    normalIndices.clear();
+    textureIndices.clear();
+    clearTangents();
+
+    boundsValid = false;
+
+    return static_cast<Mesh &>(*this);
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+Mesh & TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::create(
+    const std::vector<Vector3Type> & vertices,
+    const std::vector<Vector3Type> & normals,
+    const std::vector<Vector2Type> & textureCoordinates,
+    const std::vector<size_t> & vertexIndices,
+    const std::vector<size_t> & normalIndices,
+    const std::vector<size_t> & textureIndices) {
+    this->vertices = vertices;
+    this->normals = normals;
+    this->textureCoordinates = textureCoordinates;
+    this->vertexIndices = IndexBuffer(vertexIndices);
+    this->normalIndices = IndexBuffer(normalIndices);
+    this->textureIndices = IndexBuffer(textureIndices);
+
+    clearTangents();
+
+    boundsValid = false;
+
+    return static_cast<Mesh &>(*this);
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+Mesh & TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::create(
+    std::vector<Vector3Type> && vertices,
+    std::vector<Vector3Type> && normals,
+    std::vector<Vector2Type> && textureCoordinates,
+    std::vector<size_t> && vertexIndices,
+    std::vector<size_t> && normalIndices,
+    std::vector<size_t> && textureIndices) {
+    return create(std::move(vertices), std::move(normals), std::move(textureCoordinates),
+        IndexBuffer(std::move(vertexIndices)), IndexBuffer(std::move(normalIndices)),
+        IndexBuffer(std::move(textureIndices)));
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+Mesh & TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::create(
+    std::vector<Vector3Type> && vertices,
+    std::vector<Vector3Type> && normals,
+    std::vector<Vector2Type> && textureCoordinates,
+    IndexBuffer && vertexIndices,
+    IndexBuffer && normalIndices,
+    IndexBuffer && textureIndices) {
+    this->vertices = std::move(vertices);
+    this->normals = std::move(normals);
+    this->textureCoordinates = std::move(textureCoordinates);
+    this->vertexIndices = std::move(vertexIndices);
+    this->normalIndices = std::move(normalIndices);
+    this->textureIndices = std::move(textureIndices);
+
+    clearTangents();
+
+    boundsValid = false;
+
+    return static_cast<Mesh &>(*this);
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+Mesh & TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::release(
+    std::vector<Vector3Type> & vertices,
+    std::vector<Vector3Type> & normals,
+    std::vector<Vector2Type> & textureCoordinates,
+    std::vector<size_t> & vertexIndices,
+    std::vector<size_t> & normalIndices,
+    std::vector<size_t> & textureIndices) {
+    vertices = std::move(this->vertices);
+    normals = std::move(this->normals);
+    textureCoordinates = std::move(this->textureCoordinates);
+
+    this->vertexIndices.release(vertexIndices);
+    this->normalIndices.release(normalIndices);
+    this->textureIndices.release(textureIndices);
+
+    this->vertices.clear();
+    this->normals.clear();
+    this->textureCoordinates.clear();
+
+    clearTangents();
+
+    boundsValid = false;
+
+    return static_cast<Mesh &>(*this);
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+Mesh & TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::clearTangents() {
+    tangents.clear();
+    bitangents.clear();
+    tangentIndices.clear();
+
+    return static_cast<Mesh &>(*this);
+}
+
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+void TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::updateBounds() const {
+    // Volumes válidos são lidos sem bloqueio (publicados pela escrita de "boundsValid")
+    if (boundsValid.load(std::memory_order_acquire))
+        return;
+
+    std::lock_guard<std::mutex> lock(boundsMutex);
+
+    if (!boundsValid.load(std::memory_order_relaxed)) {
+        computeBounds(vertices, boundingBox, boundingSphere);
+        boundsValid.store(true, std::memory_order_release);
+    }
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+void TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::copyBounds(const TriangleMeshBase & triangleMesh) {
+    if (this == &triangleMesh)
+        return;
+
+    if (triangleMesh.boundsValid.load(std::memory_order_acquire)) {
+        boundingBox = triangleMesh.boundingBox;
+        boundingSphere = triangleMesh.boundingSphere;
+        boundsValid.store(true, std::memory_order_release);
+    }
+    else
+        boundsValid = false;
+}
+
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+Mesh & TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::reorderTriangles(const std::vector<size_t> & order) {
+    vertexIndices.reorderTriangles(order);
+
+    if (hasNormals())
+        normalIndices.reorderTriangles(order);
+
+    if (hasTextureCoordinates())
+        textureIndices.reorderTriangles(order);
+
+    if (hasTangents())
+        tangentIndices.reorderTriangles(order);
+
+    return static_cast<Mesh &>(*this);
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+Mesh & TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::reorderAttributes(
+    const std::vector<size_t> & vertexRemap,
+    const std::vector<size_t> & normalRemap,
+    const std::vector<size_t> & textureRemap) {
+    if (!vertexRemap.empty()) {
+        remapVectors(vertices, vertexRemap);
+        vertexIndices.remap(vertexRemap);
+    }
+
+    if (hasNormals() && !normalRemap.empty()) {
+        remapVectors(normals, normalRemap);
+        normalIndices.remap(normalRemap);
+    }
+
+    if (hasTextureCoordinates() && !textureRemap.empty()) {
+        remapVectors(textureCoordinates, textureRemap);
+        textureIndices.remap(textureRemap);
+    }
+
+    return static_cast<Mesh &>(*this);
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+Mesh & TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::transform(
+    const Matrix4 & transformation, size_t threadCount) {
+    // Volumes envolventes válidos acompanham transformação afim (caixa e esfera envolvem os vértices transformados)
+    bool keepBounds = boundsValid.load(std::memory_order_acquire) && transformation.isAffine();
+
+    transformVectors<Real>(vertices, transformation, false, threadCount);
+
+    if (hasNormals())
+        transformVectors<Real>(normals, getNormalTransformation(transformation), true, threadCount);
+
+    // Vetores tangentes acompanham a superfície (matriz sem inversão)
+    if (hasTangents()) {
+        transformVectors<Real>(tangents, transformation, true, threadCount);
+        transformVectors<Real>(bitangents, transformation, true, threadCount);
+    }
+
+    if (keepBounds)
+        transformBounds(boundingBox, boundingSphere, transformation, 4.0 * std::numeric_limits<Real>::epsilon());
+    else
+        boundsValid = false;
+
+    return static_cast<Mesh &>(*this);
+}
+template<typename Mesh, typename Vector3Type, typename Vector2Type, typename Real>
+template<typename OtherMesh>
+Mesh & TriangleMeshBase<Mesh, Vector3Type, Vector2Type, Real>::convert(const OtherMesh & triangleMesh) {
+    convertVectors(triangleMesh.getVertices(), vertices);
+    convertVectors(triangleMesh.getNormals(), normals);
+    convertVectors(triangleMesh.getTextureCoordinates(), textureCoordinates);
+    vertexIndices = triangleMesh.getVertexIndices();
+    normalIndices = triangleMesh.getNormalIndices();
+    textureIndices = triangleMesh.getTextureIndices();
+    convertVectors(triangleMesh.getTangents(), tangents);
+    convertVectors(triangleMesh.getBitangents(), bitangents);
+    tangentIndices = triangleMesh.getTangentIndices();
+
+    // Arredondamento dos vértices convertidos altera os volumes envolventes
+    boundsValid = false;
+
+    return static_cast<Mesh &>(*this);
+}
+
+// Instanciação das geometrias de precisão dupla e simples
+template class TriangleMeshBase<TriangleMesh, Vector3, Vector2, double>;
+template class TriangleMeshBase<TriangleMeshf, Vector3f, Vector2f, float>;
+
+// Imprime informações da geometria na saída de dados
+template<typename Mesh>
+static std::ostream & printMesh(std::ostream & lhs, const Mesh & rhs) {
+    return lhs << "Vertices: " << rhs.getVertexCount() << std::endl
+        << "Triangles: " << rhs.getTriangleCount() << std::endl
+        << "Normals: " << rhs.getNormalCount() << std::endl
+        << "Texture coordinates: " << rhs.getTextureCoordinateCount();
+}
+
+TriangleMesh::TriangleMesh() {}
+TriangleMesh::TriangleMesh(const TriangleMesh & triangleMesh) {
+    create(triangleMesh);
+}
+TriangleMesh::TriangleMesh(TriangleMesh && triangleMesh) {
+    create(std::move(triangleMesh));
+}
+TriangleMesh::TriangleMesh(const TriangleMeshf & triangleMesh) {
+    create(triangleMesh);
+}
+
+TriangleMesh & TriangleMesh::operator =(const TriangleMesh & rhs) {
+    return create(rhs);
+}
+TriangleMesh & TriangleMesh::operator =(TriangleMesh && rhs) {
+    return create(std::move(rhs));
+}
+std::ostream & operator <<(std::ostream & lhs, const TriangleMesh & rhs) {
+    return printMesh(lhs, rhs);
+}
+
+TriangleMesh & TriangleMesh::create(const TriangleMeshf & triangleMesh) {
+    return convert(triangleMesh);
+}
+
+TriangleMeshf::TriangleMeshf() {}
+TriangleMeshf::TriangleMeshf(const TriangleMeshf & triangleMesh) {
+    create(triangleMesh);
+}
+TriangleMeshf::TriangleMeshf(TriangleMeshf && triangleMesh) {
+    create(std::move(triangleMesh));
+}
+TriangleMeshf::TriangleMeshf(const TriangleMesh & triangleMesh) {
+    create(triangleMesh);
+}
+
+TriangleMeshf & TriangleMeshf::operator =(const TriangleMeshf & rhs) {
+    return create(rhs);
+}
+TriangleMeshf & TriangleMeshf::operator =(TriangleMeshf && rhs) {
+    return create(std::move(rhs));
+}
+std::ostream & operator <<(std::ostream & lhs, const TriangleMeshf & rhs) {
+    return printMesh(lhs, rhs);
+}
+
+TriangleMeshf & TriangleMeshf::create(const TriangleMesh & triangleMesh) {
+    return convert(triangleMesh);
+}
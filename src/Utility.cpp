@@ -1,168 +1,761 @@
-// File:    Utility.cpp
-// Author:  Danilo Peixoto
-// Date:    15/08/2018
-
-#include <Utility.h>
-#include <Vector.h>
-#include <TriangleMesh.h>
-#include <Viewport.h>
-
-#include <vector>
-#include <sstream>
-#include <fstream>
-#include <algorithm>
-
-Viewport3D viewport3D;
-
-TriangleMesh * readObject(const std::string & filename) {
-    std::ifstream file(filename, std::ifstream::in);
-
-    if (!file.is_open())
-        return nullptr;
-
-    std::vector<Vector3> vertices, normals;
-    std::vector<Vector2> textureCoordinates;
-    std::vector<size_t> vertexIndices, normalIndices, textureIndices;
-
-    std::string line;
-
-    while (std::getline(file, line)) {
-        std::istringstream attributes(line);
-
-        std::string type;
-        attributes >> type;
-
-        if (type == "v") {
-            Vector3 vertex;
-            attributes >> vertex.x >> vertex.y >> vertex.z;
-
-            vertices.push_back(vertex);
-        }
-        else if (type == "vt") {
-            Vector2 uvCoordinates;
-            attributes >> uvCoordinates.x >> uvCoordinates.y;
-
-            textureCoordinates.push_back(uvCoordinates);
-        }
-        else if (type == "vn") {
-            Vector3 normal;
-            attributes >> normal.x >> normal.y >> normal.z;
-
-            normals.push_back(normal);
-        }
-        else if (type == "f") {
-            for (size_t i = 0; i < 3; i++) {
-                std::string tokens;
-                attributes >> tokens;
-
-                std::replace(tokens.begin(), tokens.end(), '/', ' ');
-
-                std::istringstream indices(tokens);
-                size_t index;
-
-                indices >> index;
-                vertexIndices.push_back(index - 1);
-
-                if (indices.peek() == ' ') {
-                    indices.ignore();
-
-                    if (indices.peek() == ' ') {
-                        indices.ignore();
-
-                        indices >> index;
-                        normalIndices.push_back(index - 1);
-                    }
-                    else {
-                        indices >> index;
-                        textureIndices.push_back(index - 1);
-
-                        if (indices.peek() == ' ') {
-                            indices.ignore();
-
-                            indices >> index;
-                            normalIndices.push_back(index - 1);
-                        }
-                    }
-                }
-            }
-        }
-    }
-
-    file.close();
-
-    return new TriangleMesh(vertices, normals, textureCoordinates,
-        vertexIndices, normalIndices, textureIndices);
-}
-bool writeObject(const std::string & filename, const TriangleMesh * triangleMesh) {
-    std::ofstream file(filename, std::ofstream::out | std::ofstream::trunc);
-
-    if (!file.is_open())
-        return false;
-
-    file.setf(std::ofstream::fixed);
-    file.precision(5);
-
-    for (size_t i = 0; i < triangleMesh->getVertexCount(); i++) {
-        const Vector3 & vertex = triangleMesh->getVertex(i);
-        file << "v " << vertex.x << ' ' << vertex.y << ' ' << vertex.z << std::endl;
-    }
-
-    for (size_t i = 0; i < triangleMesh->getTextureCoordinateCount(); i++) {
-        const Vector2 & uvCoordinates = triangleMesh->getTextureCoordinates(i);
-        file << "vt " << uvCoordinates.x << ' ' << uvCoordinates.y << std::endl;
-    }
-
-    for (size_t i = 0; i < triangleMesh->getNormalCount(); i++) {
-        const Vector3 & normal = triangleMesh->getNormal(i);
-        file << "vn " << normal.x << ' ' << normal.y << ' ' << normal.z << std::endl;
-    }
-
-    size_t triangleCount = triangleMesh->getTriangleCount();
-
-    bool hasNormals = triangleMesh->hasNormals();
-    bool hasTextureCoordinates = triangleMesh->hasTextureCoordinates();
-
-    for (size_t i = 0; i < triangleCount; i++) {
-        size_t vertexIndices[3], textureIndices[3], normalIndices[3];
-
-        triangleMesh->getVertexIndices(i, vertexIndices[0], vertexIndices[1], vertexIndices[2]);
-
-        if (hasTextureCoordinates)
-            triangleMesh->getTextureIndices(i, textureIndices[0], textureIndices[1], textureIndices[2]);
-
-        if (hasNormals)
-            triangleMesh->getNormalIndices(i, normalIndices[0], normalIndices[1], normalIndices[2]);
-
-        file << "f ";
-
-        for (size_t j = 0; j < 3; j++) {
-            file << vertexIndices[j] + 1;
-
-            if (hasTextureCoordinates)
-                file << '/' << textureIndices[j] + 1;
-
-            if (hasNormals) {
-                if (!hasTextureCoordinates)
-                    file << '/';
-
-                file << '/' << normalIndices[j] + 1;
-            }
-
-            if (j < 2)
-                file << ' ';
-        }
-
-        if (i < triangleCount - 1)
-            file << std::endl;
-    }
-
-    file.close();
-
-    return true;
-}
-void showObject(const TriangleMesh * triangleMesh) {
-    viewport3D.clear();
-    viewport3D.add(triangleMesh);
-
-    viewport3D.show();
-}
\ No newline at end of file
+// File:    Utility.cpp
+// Author:  Danilo Peixoto
+// Date:    15/08/2018
+
+#include <Utility.h>
+#include <Vector.h>
+#include <TriangleMesh.h>
+#include <Viewport.h>
+#include <File.h>
+#include <Text.h>
+#include <Thread.h>
+
+#include <vector>
+#include <fstream>
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+#include <utility>
+
+Viewport3D viewport3D;
+
+// Índices de uma face como escritos no arquivo (negativos são relativos ao fim das listas, zero indica ausência)
+struct ObjectFace {
+    long long vertexIndices[3]; // Índices de vértices
+    long long textureIndices[3]; // Índices de coordenadas de textura
+    long long normalIndices[3]; // Índices de vetores normais
+};
+
+// Converte índice de face para índice de lista a partir do número de atributos lidos
+static size_t resolveObjectIndex(long long index, size_t count) {
+    return index < 0 ? count + index : index - 1;
+}
+// Lê índice de face (positivo absoluto ou negativo relativo)
+static const char * parseObjectIndex(const char * p, const char * end, long long & index) {
+    size_t value;
+
+    if (p != end && *p == '-') {
+        p = parseInteger(p + 1, end, value);
+        index = -(long long)value;
+    }
+    else {
+        p = parseInteger(p, end, value);
+        index = (long long)value;
+    }
+
+    return p;
+}
+// Lê registros de um trecho de arquivo Wavefront OBJ composto por linhas completas
+// e os repassa ao receptor (métodos "visitVertex", "visitTextureCoordinates", "visitNormal" e "visitFace";
+// receptores com "parsesAttributes" falso recebem atributos nulos sem conversão de texto)
+template<typename Receiver>
+static void parseObject(const char * p, const char * end, Receiver & receiver) {
+    while (p != end) {
+        p = skipSpaces(p, end);
+
+        const char * type = p;
+
+        while (p != end && !isSpace(*p) && *p != '\n')
+            p++;
+
+        size_t typeLength = p - type;
+
+        if (typeLength == 1 && type[0] == 'v') {
+            Vector3 vertex;
+
+            if (Receiver::parsesAttributes) {
+                p = parseReal(skipSpaces(p, end), end, vertex.x);
+                p = parseReal(skipSpaces(p, end), end, vertex.y);
+                p = parseReal(skipSpaces(p, end), end, vertex.z);
+            }
+
+            receiver.visitVertex(vertex);
+        }
+        else if (typeLength == 2 && type[0] == 'v' && type[1] == 't') {
+            Vector2 uvCoordinates;
+
+            if (Receiver::parsesAttributes) {
+                p = parseReal(skipSpaces(p, end), end, uvCoordinates.x);
+                p = parseReal(skipSpaces(p, end), end, uvCoordinates.y);
+            }
+
+            receiver.visitTextureCoordinates(uvCoordinates);
+        }
+        else if (typeLength == 2 && type[0] == 'v' && type[1] == 'n') {
+            Vector3 normal;
+
+            if (Receiver::parsesAttributes) {
+                p = parseReal(skipSpaces(p, end), end, normal.x);
+                p = parseReal(skipSpaces(p, end), end, normal.y);
+                p = parseReal(skipSpaces(p, end), end, normal.z);
+            }
+
+            receiver.visitNormal(normal);
+        }
+        else if (typeLength == 1 && type[0] == 'f') {
+            ObjectFace face = {};
+
+            for (size_t i = 0; i < 3; i++) {
+                p = parseObjectIndex(skipSpaces(p, end), end, face.vertexIndices[i]);
+
+                if (p != end && *p == '/') {
+                    p++;
+
+                    if (p != end && *p == '/')
+                        p = parseObjectIndex(p + 1, end, face.normalIndices[i]);
+                    else {
+                        p = parseObjectIndex(p, end, face.textureIndices[i]);
+
+                        if (p != end && *p == '/')
+                            p = parseObjectIndex(p + 1, end, face.normalIndices[i]);
+                    }
+                }
+            }
+
+            receiver.visitFace(face);
+        }
+
+        p = skipLine(p, end);
+    }
+}
+
+// Contagem de registros de um trecho de arquivo Wavefront OBJ
+struct ObjectCounter {
+    static const bool parsesAttributes = false;
+
+    size_t vertexCount, normalCount, textureCoordinateCount;
+    size_t vertexIndexCount, normalIndexCount, textureIndexCount;
+
+    ObjectCounter()
+        : vertexCount(0), normalCount(0), textureCoordinateCount(0),
+        vertexIndexCount(0), normalIndexCount(0), textureIndexCount(0) {}
+
+    void visitVertex(const Vector3 &) {
+        vertexCount++;
+    }
+    void visitTextureCoordinates(const Vector2 &) {
+        textureCoordinateCount++;
+    }
+    void visitNormal(const Vector3 &) {
+        normalCount++;
+    }
+    void visitFace(const ObjectFace & face) {
+        for (size_t i = 0; i < 3; i++) {
+            vertexIndexCount++;
+
+            if (face.textureIndices[i] != 0)
+                textureIndexCount++;
+
+            if (face.normalIndices[i] != 0)
+                normalIndexCount++;
+        }
+    }
+};
+// Escrita de registros de um trecho diretamente nas listas da geometria (a partir das posições do trecho;
+// atributos são convertidos para a precisão dos vetores da geometria)
+template<typename Vector3Type, typename Vector2Type>
+struct ObjectBuilder {
+    static const bool parsesAttributes = true;
+
+    Vector3Type * vertices, * normals;
+    Vector2Type * textureCoordinates;
+    size_t * vertexIndices, * normalIndices, * textureIndices;
+    // Número de atributos lidos em todo o arquivo até a posição atual (resolve índices relativos)
+    size_t vertexCount, normalCount, textureCoordinateCount;
+
+    void visitVertex(const Vector3 & vertex) {
+        *vertices++ = Vector3Type(vertex);
+        vertexCount++;
+    }
+    void visitTextureCoordinates(const Vector2 & uvCoordinates) {
+        *textureCoordinates++ = Vector2Type(uvCoordinates);
+        textureCoordinateCount++;
+    }
+    void visitNormal(const Vector3 & normal) {
+        *normals++ = Vector3Type(normal);
+        normalCount++;
+    }
+    void visitFace(const ObjectFace & face) {
+        for (size_t i = 0; i < 3; i++) {
+            *vertexIndices++ = resolveObjectIndex(face.vertexIndices[i], vertexCount);
+
+            if (face.textureIndices[i] != 0)
+                *textureIndices++ = resolveObjectIndex(face.textureIndices[i], textureCoordinateCount);
+
+            if (face.normalIndices[i] != 0)
+                *normalIndices++ = resolveObjectIndex(face.normalIndices[i], normalCount);
+        }
+    }
+};
+// Repasse de registros lidos para um receptor do usuário
+struct ObjectStream {
+    static const bool parsesAttributes = true;
+
+    ObjectVisitor & visitor;
+    size_t vertexCount, normalCount, textureCoordinateCount;
+
+    ObjectStream(ObjectVisitor & visitor)
+        : visitor(visitor), vertexCount(0), normalCount(0), textureCoordinateCount(0) {}
+
+    void visitVertex(const Vector3 & vertex) {
+        vertexCount++;
+        visitor.visitVertex(vertex);
+    }
+    void visitTextureCoordinates(const Vector2 & uvCoordinates) {
+        textureCoordinateCount++;
+        visitor.visitTextureCoordinates(uvCoordinates);
+    }
+    void visitNormal(const Vector3 & normal) {
+        normalCount++;
+        visitor.visitNormal(normal);
+    }
+    void visitFace(const ObjectFace & face) {
+        size_t vertexIndices[3], textureIndices[3], normalIndices[3];
+        bool hasTextureCoordinates = true, hasNormals = true;
+
+        for (size_t i = 0; i < 3; i++) {
+            vertexIndices[i] = resolveObjectIndex(face.vertexIndices[i], vertexCount);
+            textureIndices[i] = resolveObjectIndex(face.textureIndices[i], textureCoordinateCount);
+            normalIndices[i] = resolveObjectIndex(face.normalIndices[i], normalCount);
+
+            hasTextureCoordinates &= face.textureIndices[i] != 0;
+            hasNormals &= face.normalIndices[i] != 0;
+        }
+
+        visitor.visitTriangle(vertexIndices,
+            hasTextureCoordinates ? textureIndices : nullptr,
+            hasNormals ? normalIndices : nullptr);
+    }
+};
+
+// Lê geometria de um arquivo Wavefront OBJ em paralelo com atributos na precisão dos tipos de vetores
+template<typename Mesh, typename Vector3Type, typename Vector2Type>
+static Mesh * loadObject(const std::string & filename, size_t threadCount) {
+    MappedFile file(filename);
+
+    if (!file.isOpen())
+        return nullptr;
+
+    const char * begin = file.getData();
+    const char * end = begin + file.getSize();
+
+    if (threadCount == 0)
+        threadCount = threadPool.getThreadCount();
+
+    // Trechos pequenos não compensam o custo de sincronização
+    const size_t minimumChunkSize = 1 << 20;
+
+    size_t size = file.getSize();
+    size_t chunkCount = std::max(std::min(threadCount * 4, size / minimumChunkSize), (size_t)1);
+
+    // Divide arquivo em trechos de linhas completas
+    std::vector<const char *> bounds(chunkCount + 1, end);
+    bounds[0] = begin;
+
+    for (size_t i = 1; i < chunkCount; i++) {
+        const char * bound = std::max(begin + size / chunkCount * i, bounds[i - 1]);
+        bounds[i] = bound != begin ? skipLine(bound - 1, end) : begin;
+    }
+
+    // Contagem prévia permite alocar cada lista uma única vez com tamanho exato
+    std::vector<ObjectCounter> counters(chunkCount + 1);
+
+    threadPool.run(chunkCount, [&](size_t i) {
+        parseObject(bounds[i], bounds[i + 1], counters[i + 1]);
+    }, threadCount);
+
+    // Posição inicial de cada trecho nas listas (soma dos trechos anteriores)
+    for (size_t i = 1; i <= chunkCount; i++) {
+        ObjectCounter & counter = counters[i];
+        const ObjectCounter & previous = counters[i - 1];
+
+        counter.vertexCount += previous.vertexCount;
+        counter.normalCount += previous.normalCount;
+        counter.textureCoordinateCount += previous.textureCoordinateCount;
+        counter.vertexIndexCount += previous.vertexIndexCount;
+        counter.normalIndexCount += previous.normalIndexCount;
+        counter.textureIndexCount += previous.textureIndexCount;
+    }
+
+    const ObjectCounter & total = counters[chunkCount];
+
+    std::vector<Vector3Type> vertices(total.vertexCount), normals(total.normalCount);
+    std::vector<Vector2Type> textureCoordinates(total.textureCoordinateCount);
+    std::vector<size_t> vertexIndices(total.vertexIndexCount);
+    std::vector<size_t> normalIndices(total.normalIndexCount);
+    std::vector<size_t> textureIndices(total.textureIndexCount);
+
+    threadPool.run(chunkCount, [&](size_t i) {
+        const ObjectCounter & offset = counters[i];
+        ObjectBuilder<Vector3Type, Vector2Type> builder;
+
+        builder.vertices = vertices.data() + offset.vertexCount;
+        builder.normals = normals.data() + offset.normalCount;
+        builder.textureCoordinates = textureCoordinates.data() + offset.textureCoordinateCount;
+        builder.vertexIndices = vertexIndices.data() + offset.vertexIndexCount;
+        builder.normalIndices = normalIndices.data() + offset.normalIndexCount;
+        builder.textureIndices = textureIndices.data() + offset.textureIndexCount;
+        builder.vertexCount = offset.vertexCount;
+        builder.normalCount = offset.normalCount;
+        builder.textureCoordinateCount = offset.textureCoordinateCount;
+
+        parseObject(bounds[i], bounds[i + 1], builder);
+    }, threadCount);
+
+    return new Mesh(std::move(vertices), std::move(normals), std::move(textureCoordinates),
+        IndexBuffer(std::move(vertexIndices)), IndexBuffer(std::move(normalIndices)),
+        IndexBuffer(std::move(textureIndices)));
+}
+
+TriangleMesh * readObject(const std::string & filename, size_t threadCount) {
+    return loadObject<TriangleMesh, Vector3, Vector2>(filename, threadCount);
+}
+TriangleMeshf * readObjectf(const std::string & filename, size_t threadCount) {
+    return loadObject<TriangleMeshf, Vector3f, Vector2f>(filename, threadCount);
+}
+bool readObject(const std::string & filename, ObjectVisitor & visitor) {
+    std::ifstream file(filename, std::ifstream::in | std::ifstream::binary);
+
+    if (!file.is_open())
+        return false;
+
+    // Memória utilizada é limitada ao bloco de leitura (e à maior linha do arquivo)
+    std::vector<char> buffer(1 << 16);
+    size_t remaining = 0;
+
+    ObjectStream stream(visitor);
+
+    while (true) {
+        file.read(buffer.data() + remaining, buffer.size() - remaining);
+
+        size_t size = remaining + (size_t)file.gcount();
+        bool finished = !file;
+
+        const char * begin = buffer.data();
+        const char * end = begin + size;
+        const char * lineEnd = end;
+
+        // Última linha incompleta é mantida para o próximo bloco
+        if (!finished) {
+            while (lineEnd != begin && lineEnd[-1] != '\n')
+                lineEnd--;
+
+            if (lineEnd == begin) {
+                remaining = size;
+                buffer.resize(buffer.size() * 2);
+
+                continue;
+            }
+        }
+
+        parseObject(begin, lineEnd, stream);
+
+        if (finished)
+            break;
+
+        remaining = end - lineEnd;
+        std::copy(lineEnd, end, buffer.begin());
+    }
+
+    return !file.bad();
+}
+// Tamanho máximo de uma linha de arquivo Wavefront OBJ escrita
+static const size_t maximumObjectLineSize = 4 * CGC_REAL_TEXT_SIZE;
+
+// Formata linha de atributo com "size" componentes ("v", "vt" e "vn")
+template<typename Vector>
+static char * formatObjectLine(char * p, const char * type, const Vector & vector, size_t size,
+    int precision) {
+    while (*type != '\0')
+        *p++ = *type++;
+
+    for (size_t i = 0; i < size; i++) {
+        *p++ = ' ';
+        p = formatReal(p, vector[i], precision);
+    }
+
+    *p++ = '\n';
+
+    return p;
+}
+// Formata linha de face de um triângulo (sem quebra de linha)
+template<typename Mesh>
+static char * formatObjectFace(char * p, const Mesh * triangleMesh, size_t i,
+    bool hasNormals, bool hasTextureCoordinates) {
+    size_t vertexIndices[3], textureIndices[3], normalIndices[3];
+
+    triangleMesh->getVertexIndices(i, vertexIndices[0], vertexIndices[1], vertexIndices[2]);
+
+    if (hasTextureCoordinates)
+        triangleMesh->getTextureIndices(i, textureIndices[0], textureIndices[1], textureIndices[2]);
+
+    if (hasNormals)
+        triangleMesh->getNormalIndices(i, normalIndices[0], normalIndices[1], normalIndices[2]);
+
+    *p++ = 'f';
+    *p++ = ' ';
+
+    for (size_t j = 0; j < 3; j++) {
+        p = formatInteger(p, vertexIndices[j] + 1);
+
+        if (hasTextureCoordinates) {
+            *p++ = '/';
+            p = formatInteger(p, textureIndices[j] + 1);
+        }
+
+        if (hasNormals) {
+            if (!hasTextureCoordinates)
+                *p++ = '/';
+
+            *p++ = '/';
+            p = formatInteger(p, normalIndices[j] + 1);
+        }
+
+        if (j < 2)
+            *p++ = ' ';
+    }
+
+    return p;
+}
+
+// Formata linhas [begin, end) do arquivo (vértices, coordenadas de textura, vetores normais e faces
+// em sequência) na memória do trecho e retorna o tamanho do texto
+template<typename Mesh>
+static size_t formatObjectLines(std::vector<char> & buffer, const Mesh * triangleMesh,
+    size_t begin, size_t end, int precision) {
+    size_t vertexCount = triangleMesh->getVertexCount();
+    size_t textureCoordinateCount = triangleMesh->getTextureCoordinateCount();
+    size_t normalCount = triangleMesh->getNormalCount();
+    size_t triangleCount = triangleMesh->getTriangleCount();
+
+    size_t textureCoordinateOffset = vertexCount;
+    size_t normalOffset = textureCoordinateOffset + textureCoordinateCount;
+    size_t triangleOffset = normalOffset + normalCount;
+
+    bool hasNormals = triangleMesh->hasNormals();
+    bool hasTextureCoordinates = triangleMesh->hasTextureCoordinates();
+
+    size_t size = 0;
+
+    for (size_t i = begin; i < end; i++) {
+        if (buffer.size() - size < maximumObjectLineSize)
+            buffer.resize(buffer.size() * 2 + maximumObjectLineSize);
+
+        char * p = buffer.data() + size;
+
+        if (i < textureCoordinateOffset)
+            p = formatObjectLine(p, "v", triangleMesh->getVertex(i), 3, precision);
+        else if (i < normalOffset)
+            p = formatObjectLine(p, "vt", triangleMesh->getTextureCoordinates(i - textureCoordinateOffset), 2, precision);
+        else if (i < triangleOffset)
+            p = formatObjectLine(p, "vn", triangleMesh->getNormal(i - normalOffset), 3, precision);
+        else {
+            size_t j = i - triangleOffset;
+            p = formatObjectFace(p, triangleMesh, j, hasNormals, hasTextureCoordinates);
+
+            if (j < triangleCount - 1)
+                *p++ = '\n';
+        }
+
+        size = p - buffer.data();
+    }
+
+    return size;
+}
+
+// Escreve geometria para um arquivo Wavefront OBJ formatando trechos do arquivo em paralelo
+template<typename Mesh>
+static bool saveObject(const std::string & filename, const Mesh * triangleMesh,
+    int precision, size_t threadCount) {
+    std::ofstream file(filename, std::ofstream::out | std::ofstream::trunc);
+
+    if (!file.is_open())
+        return false;
+
+    precision = std::min(precision, 17);
+
+    if (threadCount == 0)
+        threadCount = threadPool.getThreadCount();
+
+    size_t lineCount = triangleMesh->getVertexCount() + triangleMesh->getTextureCoordinateCount()
+        + triangleMesh->getNormalCount() + triangleMesh->getTriangleCount();
+
+    // Trechos de linhas são formatados em paralelo e escritos em ordem a cada rodada
+    const size_t chunkLineCount = 1 << 14;
+
+    size_t chunkCount = (lineCount + chunkLineCount - 1) / chunkLineCount;
+    size_t roundChunkCount = std::min(threadCount * 4, chunkCount);
+
+    std::vector<std::vector<char>> buffers(roundChunkCount);
+    std::vector<size_t> sizes(roundChunkCount);
+
+    for (size_t first = 0; first < chunkCount; first += roundChunkCount) {
+        size_t count = std::min(roundChunkCount, chunkCount - first);
+
+        threadPool.run(count, [&](size_t i) {
+            size_t begin = (first + i) * chunkLineCount;
+            size_t end = std::min(begin + chunkLineCount, lineCount);
+
+            sizes[i] = formatObjectLines(buffers[i], triangleMesh, begin, end, precision);
+        }, threadCount);
+
+        for (size_t i = 0; i < count; i++)
+            file.write(buffers[i].data(), sizes[i]);
+    }
+
+    file.close();
+
+    return !file.fail();
+}
+
+bool writeObject(const std::string & filename, const TriangleMesh * triangleMesh,
+    int precision, size_t threadCount) {
+    return saveObject(filename, triangleMesh, precision, threadCount);
+}
+bool writeObject(const std::string & filename, const TriangleMeshf * triangleMesh,
+    int precision, size_t threadCount) {
+    return saveObject(filename, triangleMesh, precision, threadCount);
+}
+// Cabeçalho do formato binário de geometria (seções de atributos alinhadas após o cabeçalho)
+struct BinaryMeshHeader {
+    char identifier[8]; // Identificador do formato
+    uint32_t version; // Versão do formato
+    uint32_t alignment; // Alinhamento das seções em bytes
+    uint64_t vertexCount; // Número de vértices
+    uint64_t normalCount; // Número de vetores normais
+    uint64_t textureCoordinateCount; // Número de coordenadas de textura
+    uint64_t vertexIndexCount; // Número de índices de vértices
+    uint64_t normalIndexCount; // Número de índices de vetores normais
+    uint64_t textureIndexCount; // Número de índices de coordenadas de textura
+    uint32_t vertexIndexWidth; // Largura dos índices de vértices em bytes
+    uint32_t normalIndexWidth; // Largura dos índices de vetores normais em bytes
+    uint32_t textureIndexWidth; // Largura dos índices de coordenadas de textura em bytes
+    uint32_t reserved; // Preenchimento reservado
+    uint64_t checksum; // Soma de verificação das seções
+};
+
+static const char binaryMeshIdentifier[8] = { 'C', 'G', 'C', 'M', 'E', 'S', 'H', '\0' };
+static const uint32_t binaryMeshVersion = 2;
+static const uint32_t binaryMeshAlignment = 16;
+
+// Retorna tamanho alinhado de uma seção
+static uint64_t alignBinarySize(uint64_t size) {
+    return (size + binaryMeshAlignment - 1) / binaryMeshAlignment * binaryMeshAlignment;
+}
+// Acumula soma de verificação de 64 bits sobre um bloco de bytes (palavras de 8 bytes por iteração)
+static uint64_t updateChecksum(uint64_t checksum, const void * data, size_t size) {
+    const unsigned char * bytes = (const unsigned char *)data;
+    const uint64_t prime = UINT64_C(0x100000001b3);
+
+    for (; size >= 8; bytes += 8, size -= 8) {
+        uint64_t word;
+        std::memcpy(&word, bytes, 8);
+
+        checksum = (checksum ^ word) * prime;
+        checksum ^= checksum >> 29;
+    }
+
+    for (; size != 0; bytes++, size--)
+        checksum = (checksum ^ *bytes) * prime;
+
+    return checksum;
+}
+// Escreve seção de atributos com preenchimento de alinhamento
+static void writeBinarySection(std::ofstream & file, const void * data, size_t size) {
+    static const char padding[binaryMeshAlignment] = {};
+
+    file.write((const char *)data, size);
+    file.write(padding, alignBinarySize(size) - size);
+}
+// Retorna largura em bytes dos índices no arquivo (índices de largura completa são gravados com 64 bits)
+static uint32_t getBinaryIndexWidth(const IndexBuffer & indices) {
+    return indices.getWidth() <= 4 ? (uint32_t)indices.getWidth() : 8;
+}
+// Escreve índices na largura compacta (índices de largura completa como inteiros de 64 bits)
+static void writeBinaryIndices(std::ofstream & file, const IndexBuffer & indices, uint64_t & checksum) {
+    if (getBinaryIndexWidth(indices) != 8) {
+        checksum = updateChecksum(checksum, indices.getData(), indices.getMemorySize());
+        writeBinarySection(file, indices.getData(), indices.getMemorySize());
+
+        return;
+    }
+
+    std::vector<uint64_t> values(indices.getSize());
+
+    for (size_t i = 0; i < values.size(); i++)
+        values[i] = indices[i];
+
+    checksum = updateChecksum(checksum, values.data(), values.size() * sizeof(uint64_t));
+    writeBinarySection(file, values.data(), values.size() * sizeof(uint64_t));
+}
+// Copia seção de atributos do arquivo mapeado
+template<typename T>
+static const char * readBinarySection(const char * p, std::vector<T> & values, uint64_t count) {
+    values.resize((size_t)count);
+    std::memcpy((void *)values.data(), p, values.size() * sizeof(T));
+
+    return p + alignBinarySize(count * sizeof(T));
+}
+// Copia seção de índices do arquivo mapeado na largura gravada
+static const char * readBinaryIndices(const char * p, IndexBuffer & indices, uint64_t count, uint32_t width) {
+    if (width == 2 || width == 4) {
+        indices = IndexBuffer((size_t)count, width == 2 ? UINT16_MAX : UINT32_MAX);
+        std::memcpy(indices.getData(), p, indices.getMemorySize());
+    }
+    else {
+        std::vector<size_t> values((size_t)count);
+
+        for (size_t i = 0; i < values.size(); i++) {
+            uint64_t index;
+            std::memcpy(&index, p + i * sizeof(uint64_t), sizeof(uint64_t));
+
+            values[i] = (size_t)index;
+        }
+
+        indices = IndexBuffer(std::move(values));
+    }
+
+    return p + alignBinarySize(count * width);
+}
+
+TriangleMesh * readBinaryMesh(const std::string & filename) {
+    MappedFile file(filename);
+
+    if (!file.isOpen() || file.getSize() < sizeof(BinaryMeshHeader))
+        return nullptr;
+
+    BinaryMeshHeader header;
+    std::memcpy(&header, file.getData(), sizeof(BinaryMeshHeader));
+
+    if (std::memcmp(header.identifier, binaryMeshIdentifier, sizeof(binaryMeshIdentifier)) != 0
+        || header.version != binaryMeshVersion || header.alignment != binaryMeshAlignment)
+        return nullptr;
+
+    // Tamanho esperado impede leitura além do arquivo em dados truncados ou corrompidos
+    uint64_t maximumCount = file.getSize() / sizeof(uint16_t);
+
+    if (header.vertexCount > maximumCount || header.normalCount > maximumCount
+        || header.textureCoordinateCount > maximumCount || header.vertexIndexCount > maximumCount
+        || header.normalIndexCount > maximumCount || header.textureIndexCount > maximumCount)
+        return nullptr;
+
+    const uint32_t widths[3] = { header.vertexIndexWidth, header.normalIndexWidth, header.textureIndexWidth };
+
+    for (size_t i = 0; i < 3; i++) {
+        if (widths[i] != 2 && widths[i] != 4 && widths[i] != 8)
+            return nullptr;
+    }
+
+    uint64_t size = alignBinarySize(sizeof(BinaryMeshHeader))
+        + alignBinarySize(header.vertexCount * sizeof(Vector3))
+        + alignBinarySize(header.normalCount * sizeof(Vector3))
+        + alignBinarySize(header.textureCoordinateCount * sizeof(Vector2))
+        + alignBinarySize(header.vertexIndexCount * header.vertexIndexWidth)
+        + alignBinarySize(header.normalIndexCount * header.normalIndexWidth)
+        + alignBinarySize(header.textureIndexCount * header.textureIndexWidth);
+
+    if (size != file.getSize())
+        return nullptr;
+
+    const char * p = file.getData() + alignBinarySize(sizeof(BinaryMeshHeader));
+
+    std::vector<Vector3> vertices, normals;
+    std::vector<Vector2> textureCoordinates;
+    IndexBuffer vertexIndices, normalIndices, textureIndices;
+
+    uint64_t checksum = 0;
+    const char * section = p;
+
+    p = readBinarySection(p, vertices, header.vertexCount);
+    checksum = updateChecksum(checksum, section, header.vertexCount * sizeof(Vector3));
+    section = p;
+
+    p = readBinarySection(p, normals, header.normalCount);
+    checksum = updateChecksum(checksum, section, header.normalCount * sizeof(Vector3));
+    section = p;
+
+    p = readBinarySection(p, textureCoordinates, header.textureCoordinateCount);
+    checksum = updateChecksum(checksum, section, header.textureCoordinateCount * sizeof(Vector2));
+    section = p;
+
+    p = readBinaryIndices(p, vertexIndices, header.vertexIndexCount, header.vertexIndexWidth);
+    checksum = updateChecksum(checksum, section, header.vertexIndexCount * header.vertexIndexWidth);
+    section = p;
+
+    p = readBinaryIndices(p, normalIndices, header.normalIndexCount, header.normalIndexWidth);
+    checksum = updateChecksum(checksum, section, header.normalIndexCount * header.normalIndexWidth);
+    section = p;
+
+    p = readBinaryIndices(p, textureIndices, header.textureIndexCount, header.textureIndexWidth);
+    checksum = updateChecksum(checksum, section, header.textureIndexCount * header.textureIndexWidth);
+
+    if (checksum != header.checksum)
+        return nullptr;
+
+    return new TriangleMesh(std::move(vertices), std::move(normals), std::move(textureCoordinates),
+        std::move(vertexIndices), std::move(normalIndices), std::move(textureIndices));
+}
+bool writeBinaryMesh(const std::string & filename, const TriangleMesh * triangleMesh) {
+    std::ofstream file(filename, std::ofstream::out | std::ofstream::binary | std::ofstream::trunc);
+
+    if (!file.is_open())
+        return false;
+
+    const std::vector<Vector3> & vertices = triangleMesh->getVertices();
+    const std::vector<Vector3> & normals = triangleMesh->getNormals();
+    const std::vector<Vector2> & textureCoordinates = triangleMesh->getTextureCoordinates();
+
+    BinaryMeshHeader header = {};
+    std::memcpy(header.identifier, binaryMeshIdentifier, sizeof(binaryMeshIdentifier));
+
+    header.version = binaryMeshVersion;
+    header.alignment = binaryMeshAlignment;
+    header.vertexCount = vertices.size();
+    header.normalCount = normals.size();
+    header.textureCoordinateCount = textureCoordinates.size();
+    header.vertexIndexCount = triangleMesh->getVertexIndices().getSize();
+    header.vertexIndexWidth = getBinaryIndexWidth(triangleMesh->getVertexIndices());
+    header.normalIndexCount = triangleMesh->getNormalIndices().getSize();
+    header.normalIndexWidth = getBinaryIndexWidth(triangleMesh->getNormalIndices());
+    header.textureIndexCount = triangleMesh->getTextureIndices().getSize();
+    header.textureIndexWidth = getBinaryIndexWidth(triangleMesh->getTextureIndices());
+
+    // Cabeçalho é reescrito ao final com a soma de verificação
+    writeBinarySection(file, &header, sizeof(BinaryMeshHeader));
+
+    uint64_t checksum = 0;
+
+    checksum = updateChecksum(checksum, vertices.data(), vertices.size() * sizeof(Vector3));
+    writeBinarySection(file, vertices.data(), vertices.size() * sizeof(Vector3));
+
+    checksum = updateChecksum(checksum, normals.data(), normals.size() * sizeof(Vector3));
+    writeBinarySection(file, normals.data(), normals.size() * sizeof(Vector3));
+
+    checksum = updateChecksum(checksum, textureCoordinates.data(), textureCoordinates.size() * sizeof(Vector2));
+    writeBinarySection(file, textureCoordinates.data(), textureCoordinates.size() * sizeof(Vector2));
+
+    writeBinaryIndices(file, triangleMesh->getVertexIndices(), checksum);
+    writeBinaryIndices(file, triangleMesh->getNormalIndices(), checksum);
+    writeBinaryIndices(file, triangleMesh->getTextureIndices(), checksum);
+
+    header.checksum = checksum;
+
+    file.seekp(0);
+    file.write((const char *)&header, sizeof(BinaryMeshHeader));
+    file.close();
+
+    return !file.fail();
+}
+ObjectVisitor::~ObjectVisitor() {}
+
+void ObjectVisitor::visitVertex(const Vector3 &) {}
+void ObjectVisitor::visitTextureCoordinates(const Vector2 &) {}
+void ObjectVisitor::visitNormal(const Vector3 &) {}
+void ObjectVisitor::visitTriangle(const size_t *, const size_t *, const size_t *) {}
+
+void showObject(const TriangleMesh * triangleMesh) {
+    viewport3D.clear();
+    viewport3D.add(triangleMesh);
+
+    viewport3D.show();
+}
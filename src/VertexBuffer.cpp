@@ -0,0 +1,202 @@
+// File:    VertexBuffer.cpp
+// Author:  Danilo Peixoto
+// Date:    17/10/2026
+
+#include <VertexBuffer.h>
+#include <TriangleMesh.h>
+
+#include <algorithm>
+#include <cstdint>
+
+// Combina índices de vértice, vetor normal e coordenadas de textura de um canto de triângulo
+static size_t hashCorner(size_t vertexIndex, size_t normalIndex, size_t textureIndex) {
+    uint64_t hash = (uint64_t)vertexIndex * UINT64_C(0x9E3779B97F4A7C15);
+
+    hash = (hash ^ normalIndex) * UINT64_C(0xC2B2AE3D27D4EB4F);
+    hash = (hash ^ textureIndex) * UINT64_C(0x165667B19E3779F9);
+
+    return (size_t)(hash ^ (hash >> 32));
+}
+// Solda cantos de triângulos com a mesma combinação de índices em um único vértice intercalado
+// (tabela de dispersão com endereçamento aberto guarda o índice do vértice único mais um)
+template<typename Mesh>
+static void weldVertices(const Mesh & triangleMesh, std::vector<Vertex> & vertices, IndexBuffer & indices) {
+    const IndexBuffer & vertexIndices = triangleMesh.getVertexIndices();
+    const IndexBuffer & normalIndices = triangleMesh.getNormalIndices();
+    const IndexBuffer & textureIndices = triangleMesh.getTextureIndices();
+
+    bool hasNormals = triangleMesh.hasNormals();
+    bool hasTextureCoordinates = triangleMesh.hasTextureCoordinates();
+
+    size_t cornerCount = vertexIndices.getSize();
+
+    // Canto de triângulo que originou cada vértice único (chave para comparação e redistribuição)
+    std::vector<size_t> corners;
+    std::vector<size_t> table;
+
+    // Número de vértices únicos é ao menos o maior número de atributos referenciados
+    size_t expectedCount = std::max(triangleMesh.getVertexCount(),
+        std::max(hasNormals ? triangleMesh.getNormalCount() : 0,
+            hasTextureCoordinates ? triangleMesh.getTextureCoordinateCount() : 0));
+    size_t capacity = 16;
+
+    while (capacity < expectedCount * 2)
+        capacity *= 2;
+
+    table.assign(capacity, 0);
+    corners.reserve(expectedCount);
+
+    vertices.clear();
+    vertices.reserve(expectedCount);
+    indices = IndexBuffer(cornerCount, cornerCount ? cornerCount - 1 : 0);
+
+    for (size_t i = 0; i < cornerCount; i++) {
+        size_t vertexIndex = vertexIndices[i];
+        size_t normalIndex = hasNormals ? normalIndices[i] : 0;
+        size_t textureIndex = hasTextureCoordinates ? textureIndices[i] : 0;
+
+        size_t mask = capacity - 1;
+        size_t slot = hashCorner(vertexIndex, normalIndex, textureIndex) & mask;
+
+        while (true) {
+            size_t entry = table[slot];
+
+            if (entry == 0) {
+                indices.set(i, corners.size());
+                table[slot] = corners.size() + 1;
+                corners.push_back(i);
+
+                vertices.push_back(Vertex(
+                    Vector3f(triangleMesh.getVertex(vertexIndex)),
+                    hasNormals ? Vector3f(triangleMesh.getNormal(normalIndex)) : Vector3f(),
+                    hasTextureCoordinates
+                        ? Vector2f(triangleMesh.getTextureCoordinates(textureIndex)) : Vector2f()));
+
+                break;
+            }
+
+            size_t corner = corners[entry - 1];
+
+            if (vertexIndices[corner] == vertexIndex
+                && (!hasNormals || normalIndices[corner] == normalIndex)
+                && (!hasTextureCoordinates || textureIndices[corner] == textureIndex)) {
+                indices.set(i, entry - 1);
+                break;
+            }
+
+            slot = (slot + 1) & mask;
+        }
+
+        // Fator de carga limitado a 1/2 mantém sequências de sondagem curtas
+        if (corners.size() * 2 > capacity) {
+            capacity *= 2;
+            mask = capacity - 1;
+            table.assign(capacity, 0);
+
+            for (size_t j = 0; j < corners.size(); j++) {
+                size_t corner = corners[j];
+
+                slot = hashCorner(vertexIndices[corner],
+                    hasNormals ? normalIndices[corner] : 0,
+                    hasTextureCoordinates ? textureIndices[corner] : 0) & mask;
+
+                while (table[slot] != 0)
+                    slot = (slot + 1) & mask;
+
+                table[slot] = j + 1;
+            }
+        }
+    }
+
+    indices.compact();
+}
+
+Vertex::Vertex() {}
+Vertex::Vertex(const Vector3f & position, const Vector3f & normal, const Vector2f & textureCoordinates)
+    : position(position), normal(normal), textureCoordinates(textureCoordinates) {}
+Vertex::~Vertex() {}
+
+bool Vertex::operator ==(const Vertex & rhs) const {
+    return position == rhs.position && normal == rhs.normal && textureCoordinates == rhs.textureCoordinates;
+}
+bool Vertex::operator !=(const Vertex & rhs) const {
+    return !(*this == rhs);
+}
+
+VertexBuffer::VertexBuffer() : normals(false), textureCoordinates(false) {}
+VertexBuffer::VertexBuffer(const TriangleMesh & triangleMesh) {
+    create(triangleMesh);
+}
+VertexBuffer::VertexBuffer(const TriangleMeshf & triangleMesh) {
+    create(triangleMesh);
+}
+VertexBuffer::~VertexBuffer() {}
+
+const std::vector<Vertex> & VertexBuffer::getVertices() const {
+    return vertices;
+}
+const IndexBuffer & VertexBuffer::getIndices() const {
+    return indices;
+}
+const Vertex & VertexBuffer::getVertex(size_t i) const {
+    return vertices[i];
+}
+void VertexBuffer::getIndices(size_t i, size_t & v0, size_t & v1, size_t & v2) const {
+    indices.get(i * 3, v0, v1, v2);
+}
+size_t VertexBuffer::getVertexCount() const {
+    return vertices.size();
+}
+size_t VertexBuffer::getTriangleCount() const {
+    return indices.getSize() / 3;
+}
+size_t VertexBuffer::getStride() const {
+    return sizeof(Vertex);
+}
+bool VertexBuffer::hasNormals() const {
+    return normals;
+}
+bool VertexBuffer::hasTextureCoordinates() const {
+    return textureCoordinates;
+}
+
+VertexBuffer & VertexBuffer::create(const TriangleMesh & triangleMesh) {
+    weldVertices(triangleMesh, vertices, indices);
+
+    normals = triangleMesh.hasNormals();
+    textureCoordinates = triangleMesh.hasTextureCoordinates();
+
+    return *this;
+}
+VertexBuffer & VertexBuffer::create(const TriangleMeshf & triangleMesh) {
+    weldVertices(triangleMesh, vertices, indices);
+
+    normals = triangleMesh.hasNormals();
+    textureCoordinates = triangleMesh.hasTextureCoordinates();
+
+    return *this;
+}
+VertexBuffer & VertexBuffer::clear() {
+    vertices.clear();
+    indices.clear();
+
+    normals = false;
+    textureCoordinates = false;
+
+    return *this;
+}
+VertexBuffer & VertexBuffer::reorderTriangles(const std::vector<size_t> & order) {
+    indices.reorderTriangles(order);
+    return *this;
+}
+VertexBuffer & VertexBuffer::reorderVertices(const std::vector<size_t> & remap) {
+    std::vector<Vertex> result(vertices.size());
+
+    for (size_t i = 0; i < vertices.size(); i++)
+        result[remap[i]] = vertices[i];
+
+    vertices.swap(result);
+    indices.remap(remap);
+
+    return *this;
+}
@@ -1,13 +1,13 @@
-// File:    main.cpp
-// Author:  Danilo Peixoto
-// Date:    06/09/2018
-
-#include <iostream>
-
-// Testes
-int main(int argc, char ** argv) {
-    std::cout.setf(std::ios::fixed);
-    std::cout.precision(5);
-
-    return 0;
-}
+// File:    main.cpp
+// Author:  Danilo Peixoto
+// Date:    06/09/2018
+
+#include <iostream>
+
+// Testes
+int main(int argc, char ** argv) {
+    std::cout.setf(std::ios::fixed);
+    std::cout.precision(5);
+
+    return 0;
+}
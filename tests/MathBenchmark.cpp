@@ -0,0 +1,167 @@
+// File:    MathBenchmark.cpp
+// Author:  Danilo Peixoto
+// Date:    17/10/2026
+
+// Mede operações comuns dos tipos matemáticos (vetores, matrizes e cores) sobre listas de um milhão de elementos
+// e imprime o tempo por operação (menor tempo de várias execuções). Compilação (a partir da raiz do projeto):
+// g++ -std=c++11 -O2 -Iinclude tests/MathBenchmark.cpp -o MathBenchmark
+
+#include <Vector.h>
+#include <Matrix.h>
+#include <Color.h>
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <vector>
+#include <string>
+#include <type_traits>
+#include <algorithm>
+#include <cmath>
+
+// Elementos por lista
+static const size_t elementCount = 1 << 20;
+// Execuções por operação
+static const size_t runCount = 5;
+
+// Retorna tempo atual em milissegundos
+static double getTime() {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+// Retorna menor tempo em milissegundos entre as execuções da operação
+template<typename Operation>
+static double measure(Operation operation) {
+    double best = 0;
+
+    for (size_t r = 0; r < runCount; r++) {
+        double start = getTime();
+
+        operation();
+
+        double time = getTime() - start;
+
+        if (r == 0 || time < best)
+            best = time;
+    }
+
+    return best;
+}
+// Imprime tempo por operação em nanossegundos
+static void print(const std::string & name, double time, size_t count) {
+    std::cout << std::left << std::setw(28) << name << std::right << std::setw(8) << time * 1e6 / count
+        << " ns" << std::endl;
+}
+
+// Testes
+int main(int argc, char ** argv) {
+    std::cout.setf(std::ios::fixed, std::ios::floatfield);
+    std::cout.precision(2);
+
+    std::cout << "Cópia trivial: Vector3 " << std::is_trivially_copyable<Vector3>::value
+        << ", Matrix4 " << std::is_trivially_copyable<Matrix4>::value
+        << ", Color3 " << std::is_trivially_copyable<Color3>::value << std::endl;
+
+    std::vector<Vector3> a(elementCount), b(elementCount), c(elementCount);
+
+    for (size_t i = 0; i < elementCount; i++) {
+        a[i] = Vector3(i * 0.5, std::sin((double)i), 1.0 / (i + 1));
+        b[i] = Vector3(std::cos((double)i), 2.0, i * 1e-3);
+    }
+
+    Matrix4 transformation;
+    transformation.setTransformation(Vector3(1, 2, 3), Vector3(0.1, 0.2, 0.3), Vector3(1, 2, 1), Vector3());
+
+    // Resultados escalares são acumulados e impressos para evitar eliminação de código
+    double checksum = 0;
+    double time;
+
+    time = measure([&] {
+        for (size_t i = 0; i < elementCount; i++)
+            c[i] = a[i] * 0.5 + b[i];
+    });
+    print("c = a * s + b", time, elementCount);
+
+    time = measure([&] {
+        double sum = 0;
+
+        for (size_t i = 0; i < elementCount; i++)
+            sum += a[i].dot(b[i]);
+
+        checksum += sum;
+    });
+    print("dot", time, elementCount);
+
+    time = measure([&] {
+        for (size_t i = 0; i < elementCount; i++)
+            c[i] = a[i].cross(b[i]);
+    });
+    print("cross", time, elementCount);
+
+    time = measure([&] {
+        for (size_t i = 0; i < elementCount; i++) {
+            c[i] = a[i];
+            c[i].normalize();
+        }
+    });
+    print("normalize", time, elementCount);
+
+    time = measure([&] {
+        for (size_t i = 0; i < elementCount; i++)
+            c[i] = a[i] * transformation;
+    });
+    print("vector * Matrix4", time, elementCount);
+
+    // Matrizes de rotações distintas (produtos e inversas não dependem de valores repetidos)
+    size_t matrixCount = elementCount / 16;
+    std::vector<Matrix4> matrices(matrixCount), products(matrixCount);
+
+    for (size_t i = 0; i < matrixCount; i++)
+        matrices[i].setTransformation(Vector3(1, 2, 3), Vector3(i * 1e-3, 0.2, i * 2e-3), Vector3(1, 2, 1),
+            Vector3());
+
+    time = measure([&] {
+        for (size_t i = 0; i < matrixCount; i++)
+            products[i] = matrices[i] * transformation;
+    });
+    print("Matrix4 * Matrix4", time, matrixCount);
+
+    time = measure([&] {
+        Matrix4 total = transformation * 0;
+
+        for (size_t i = 0; i < matrixCount; i++)
+            total += matrices[i].inverse();
+
+        checksum += total.trace();
+    });
+    print("Matrix4 inverse", time, matrixCount);
+
+    time = measure([&] {
+        std::vector<Vector3> copy(a);
+
+        checksum += copy[7].x;
+    });
+    std::cout << std::left << std::setw(28) << "copy vector<Vector3>" << std::right << std::setw(8) << time
+        << " ms (" << elementCount * sizeof(Vector3) / time / 1e6 << " GB/s)" << std::endl;
+
+    std::vector<Color3> colors(elementCount, Color3(0.2, 0.4, 0.6));
+
+    time = measure([&] {
+        Color3 sum;
+
+        for (size_t i = 0; i < elementCount; i++)
+            sum += colors[i] * 0.25;
+
+        checksum += sum.r;
+    });
+    print("Color3 accumulate", time, elementCount);
+
+    for (size_t i = 0; i < elementCount; i += 101)
+        checksum += c[i].x + c[i].y + c[i].z;
+
+    for (size_t i = 0; i < matrixCount; i += 101)
+        checksum += products[i].trace();
+
+    std::cout << std::scientific << std::setprecision(15) << "Soma de verificação: " << checksum << std::endl;
+
+    return 0;
+}
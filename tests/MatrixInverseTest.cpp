@@ -0,0 +1,213 @@
+// File:    MatrixInverseTest.cpp
+// Author:  Danilo Peixoto
+// Date:    17/10/2026
+
+// Compara precisão e desempenho de Matrix4::inverse e Matrix4::affineInverse com a inversa anterior (adjunta
+// calculada por 16 menores e determinante por mais 4 menores). Compilação (a partir da raiz do projeto):
+// g++ -std=c++11 -O2 -Iinclude tests/MatrixInverseTest.cpp -o MatrixInverseTest
+
+#include <Matrix.h>
+#include <Vector.h>
+
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+// Amostras aleatórias por número de condição
+static const size_t sampleCount = 20000;
+// Erro da nova inversa pode exceder o erro máximo da inversa anterior por este fator
+static const double errorTolerance = 2.0;
+
+// Retorna inversa pela implementação anterior (adjunta por menores dividida pelo determinante por menores)
+static Matrix4 getPreviousInverse(const Matrix4 & m) {
+    Matrix4 adjugate(
+        m.minor(0, 0), -m.minor(1, 0), m.minor(2, 0), -m.minor(3, 0),
+        -m.minor(0, 1), m.minor(1, 1), -m.minor(2, 1), m.minor(3, 1),
+        m.minor(0, 2), -m.minor(1, 2), m.minor(2, 2), -m.minor(3, 2),
+        -m.minor(0, 3), m.minor(1, 3), -m.minor(2, 3), m.minor(3, 3));
+
+    double determinant = m[0][0] * m.minor(0, 0) - m[0][1] * m.minor(0, 1)
+        + m[0][2] * m.minor(0, 2) - m[0][3] * m.minor(0, 3);
+
+    return adjugate / determinant;
+}
+// Calcula inversa de referência por eliminação de Gauss-Jordan com pivotamento parcial em precisão estendida
+static void getReferenceInverse(const Matrix4 & m, long double inverse[4][4]) {
+    long double a[4][8];
+
+    for (size_t i = 0; i < 4; i++) {
+        for (size_t j = 0; j < 4; j++) {
+            a[i][j] = m[i][j];
+            a[i][j + 4] = i == j ? 1 : 0;
+        }
+    }
+
+    for (size_t c = 0; c < 4; c++) {
+        size_t pivot = c;
+
+        for (size_t i = c + 1; i < 4; i++)
+            if (std::fabs(a[i][c]) > std::fabs(a[pivot][c]))
+                pivot = i;
+
+        for (size_t j = 0; j < 8; j++)
+            std::swap(a[c][j], a[pivot][j]);
+
+        long double d = a[c][c];
+
+        for (size_t j = 0; j < 8; j++)
+            a[c][j] /= d;
+
+        for (size_t i = 0; i < 4; i++) {
+            if (i == c)
+                continue;
+
+            long double f = a[i][c];
+
+            for (size_t j = 0; j < 8; j++)
+                a[i][j] -= f * a[c][j];
+        }
+    }
+
+    for (size_t i = 0; i < 4; i++)
+        for (size_t j = 0; j < 4; j++)
+            inverse[i][j] = a[i][j + 4];
+}
+// Retorna maior erro absoluto relativo ao maior elemento da inversa de referência
+static double getRelativeError(const Matrix4 & inverse, long double reference[4][4]) {
+    long double error = 0, norm = 0;
+
+    for (size_t i = 0; i < 4; i++) {
+        for (size_t j = 0; j < 4; j++) {
+            error = std::max(error, std::fabs(inverse[i][j] - reference[i][j]));
+            norm = std::max(norm, std::fabs(reference[i][j]));
+        }
+    }
+
+    return (double)(error / norm);
+}
+// Retorna valor aleatório em [-1, 1]
+static double getRandom() {
+    return std::rand() / (double)RAND_MAX * 2 - 1;
+}
+// Retorna transformação afim "R S R T" com razão entre fatores de escala de até "condition"
+static Matrix4 getRandomAffine(double condition) {
+    Matrix4 rotation, scaling, rotation2, translation;
+
+    rotation.setRotation(Vector3(getRandom() * 3, getRandom() * 3, getRandom() * 3));
+    scaling.setScaling(Vector3(1, std::pow(condition, getRandom() * 0.5 + 0.5), 1 + getRandom() * 0.5));
+    rotation2.setRotation(Vector3(getRandom() * 3, getRandom() * 3, getRandom() * 3));
+    translation.setTranslation(Vector3(getRandom() * 100, getRandom() * 100, getRandom() * 100));
+
+    return rotation * scaling * rotation2 * translation;
+}
+// Retorna matriz geral (projetiva) a partir de uma transformação afim
+static Matrix4 getRandomGeneral(double condition) {
+    Matrix4 m = getRandomAffine(condition);
+
+    m[0][3] = getRandom();
+    m[1][3] = getRandom();
+    m[2][3] = getRandom();
+    m[3][3] = 1 + getRandom();
+
+    m[3][0] *= 0.01;
+    m[3][1] *= 0.01;
+    m[3][2] *= 0.01;
+
+    return m;
+}
+// Retorna tempo atual em nanossegundos
+static double getTime() {
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Testes
+int main(int argc, char ** argv) {
+    std::cout.setf(std::ios::scientific, std::ios::floatfield);
+    std::cout.precision(2);
+
+    std::srand(1);
+
+    const double conditions[] = {1, 1e3, 1e6};
+    bool passed = true;
+
+    for (double condition : conditions) {
+        double previousError = 0, inverseError = 0;
+        double previousAffineError = 0, inverseAffineError = 0, affineError = 0;
+
+        for (size_t k = 0; k < sampleCount; k++) {
+            long double reference[4][4];
+
+            Matrix4 general = getRandomGeneral(condition);
+            getReferenceInverse(general, reference);
+
+            previousError = std::max(previousError, getRelativeError(getPreviousInverse(general), reference));
+            inverseError = std::max(inverseError, getRelativeError(general.inverse(), reference));
+
+            Matrix4 affine = getRandomAffine(condition);
+            getReferenceInverse(affine, reference);
+
+            previousAffineError = std::max(previousAffineError,
+                getRelativeError(getPreviousInverse(affine), reference));
+            inverseAffineError = std::max(inverseAffineError, getRelativeError(affine.inverse(), reference));
+            affineError = std::max(affineError, getRelativeError(affine.affineInverse(), reference));
+
+            if (!affine.isAffine() || general.isAffine()) {
+                std::cout << "isAffine: classificação incorreta" << std::endl;
+                passed = false;
+            }
+        }
+
+        bool conditionPassed = inverseError <= errorTolerance * previousError
+            && inverseAffineError <= errorTolerance * previousAffineError
+            && affineError <= errorTolerance * previousAffineError;
+
+        passed = passed && conditionPassed;
+
+        std::cout << "Condição " << condition
+            << ": geral (anterior " << previousError << ", inverse " << inverseError
+            << "), afim (anterior " << previousAffineError << ", inverse " << inverseAffineError
+            << ", affineInverse " << affineError << ") " << (conditionPassed ? "OK" : "FALHOU") << std::endl;
+    }
+
+    // Desempenho: soma de todas inversas evita eliminação de código
+    std::vector<Matrix4> matrices(1024);
+
+    for (size_t i = 0; i < matrices.size(); i++)
+        matrices[i] = getRandomAffine(10);
+
+    const size_t repetitions = 1000;
+    double count = (double)(matrices.size() * repetitions);
+    Matrix4 total = matrices[0] * 0;
+
+    double t0 = getTime();
+
+    for (size_t r = 0; r < repetitions; r++)
+        for (size_t i = 0; i < matrices.size(); i++)
+            total += getPreviousInverse(matrices[i]);
+
+    double t1 = getTime();
+
+    for (size_t r = 0; r < repetitions; r++)
+        for (size_t i = 0; i < matrices.size(); i++)
+            total += matrices[i].inverse();
+
+    double t2 = getTime();
+
+    for (size_t r = 0; r < repetitions; r++)
+        for (size_t i = 0; i < matrices.size(); i++)
+            total += matrices[i].affineInverse();
+
+    double t3 = getTime();
+
+    std::cout.setf(std::ios::fixed, std::ios::floatfield);
+    std::cout.precision(1);
+
+    std::cout << "Soma das inversas: " << total.trace() << std::endl;
+    std::cout << "Tempo por inversa: anterior " << (t1 - t0) / count << " ns, inverse " << (t2 - t1) / count
+        << " ns, affineInverse " << (t3 - t2) / count << " ns" << std::endl;
+
+    return passed ? 0 : 1;
+}